@@ -0,0 +1,126 @@
+#include "GSamples.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint> // int16_t, uint16_t
+#include <vector>  // vector
+
+// A roller array of FIFO words (RX_PACKET_WORDS), interleaved as I, Q.
+static const size_t fifo_words{32768};
+
+static bool select_isa(benchmark::State& state) {
+    auto _isa{static_cast<GSamples::isa_t>(state.range(0))};
+
+    if (!GSamples::IsaForce(_isa)) {
+        state.SkipWithError("ISA not supported");
+        return false;
+    }
+    state.SetLabel(GSamples::IsaName(_isa));
+    return true;
+}
+
+static void BM_sign_extend_12(benchmark::State& state) {
+    std::vector<uint16_t> _words(fifo_words, 0x0ABC);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::SignExtend12(_words.data(), _words.size());
+        benchmark::DoNotOptimize(_words.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(uint16_t)));
+}
+
+static void BM_byte_swap(benchmark::State& state) {
+    std::vector<uint16_t> _words(fifo_words, 0x1234);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::ByteSwap(_words.data(), _words.size());
+        benchmark::DoNotOptimize(_words.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(uint16_t)));
+}
+
+static void BM_deinterleave(benchmark::State& state) {
+    std::vector<int16_t> _iq(fifo_words, 1);
+    std::vector<int16_t> _i(fifo_words / 2);
+    std::vector<int16_t> _q(fifo_words / 2);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::Deinterleave(_iq.data(), _i.data(), _q.data(), fifo_words / 2);
+        benchmark::DoNotOptimize(_i.data());
+        benchmark::DoNotOptimize(_q.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(int16_t)));
+}
+
+static void BM_interleave(benchmark::State& state) {
+    std::vector<int16_t> _i(fifo_words / 2, 1);
+    std::vector<int16_t> _q(fifo_words / 2, 2);
+    std::vector<int16_t> _iq(fifo_words);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::Interleave(_i.data(), _q.data(), _iq.data(), fifo_words / 2);
+        benchmark::DoNotOptimize(_iq.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(int16_t)));
+}
+
+static void BM_to_float(benchmark::State& state) {
+    std::vector<int16_t> _src(fifo_words, -1234);
+    std::vector<float>   _dst(fifo_words);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::ToFloat(_src.data(), _dst.data(), fifo_words, 1.0F / 2048.0F);
+        benchmark::DoNotOptimize(_dst.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(int16_t)));
+}
+
+static void BM_from_float(benchmark::State& state) {
+    std::vector<float>   _src(fifo_words, -0.6F);
+    std::vector<int16_t> _dst(fifo_words);
+
+    if (!select_isa(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        GSamples::FromFloat(_src.data(), _dst.data(), fifo_words, 2048.0F);
+        benchmark::DoNotOptimize(_dst.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fifo_words * sizeof(int16_t)));
+}
+
+// NOTE: the argument is the ISA, SCALAR is the reference
+BENCHMARK(BM_sign_extend_12)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+BENCHMARK(BM_byte_swap)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+BENCHMARK(BM_deinterleave)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+BENCHMARK(BM_interleave)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+BENCHMARK(BM_to_float)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+BENCHMARK(BM_from_float)->DenseRange(GSamples::SCALAR, GSamples::ISA_NUM - 1);
+
+BENCHMARK_MAIN();
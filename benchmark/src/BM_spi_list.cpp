@@ -0,0 +1,42 @@
+
+#include "GSPIdevice.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint> // uint8_t
+
+// A register write sequence (AD9361 style): 2 bytes command, 1 byte value.
+static const int spi_frames{64};
+static uint8_t   spi_tx[spi_frames][3];
+static uint8_t   spi_rx[spi_frames][3];
+
+static void BM_spi_single(benchmark::State& state) {
+    GSPIdevice _dev(GSPIdevice::LOOPBACK);
+    _dev.Open();
+
+    for (auto _ : state) {
+        for (auto i{0}; i < spi_frames; ++i) {
+            _dev.Transfer(spi_tx[i], spi_rx[i], sizeof(spi_tx[i]));
+        }
+    }
+
+    state.counters["messages"] = benchmark::Counter((double)_dev.GetMessages(), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_spi_list(benchmark::State& state) {
+    GSPIdevice _dev(GSPIdevice::LOOPBACK);
+    _dev.Open();
+
+    for (auto _ : state) {
+        for (auto i{0}; i < spi_frames; ++i) {
+            _dev.ListAppend(spi_tx[i], spi_rx[i], sizeof(spi_tx[i]));
+        }
+        _dev.ListSubmit();
+    }
+
+    state.counters["messages"] = benchmark::Counter((double)_dev.GetMessages(), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_spi_single);
+BENCHMARK(BM_spi_list);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+
+#include "GFiFo.hpp"
+
+#include <cstdint> // uint8_t
+#include <cstdio>  // printf
+
+// The level FSM of a depth 10 FIFO with max 8 and min 2: every transition must
+// reach the side whose push or pop crossed the threshold.
+static int failures{0};
+
+static void check(bool condition, const char* what, GFiFo::access_t access) {
+    if (!condition) {
+        printf("FAILED: %s (%s)\n", what, access == GFiFo::SPSC_ACCESS ? "SPSC" : "MPMC");
+        failures++;
+    }
+}
+
+static void push_to(GFiFo& fifo, uint32_t level) {
+    const uint8_t _data[4]{1, 2, 3, 4};
+
+    while (fifo.used() < level && fifo.Push(_data, sizeof(_data))) {}
+}
+
+static void pop_to(GFiFo& fifo, uint32_t level) {
+    uint8_t _data[4];
+
+    while (fifo.used() > level && fifo.Pop(_data, sizeof(_data)) > 0) {}
+}
+
+static void test_levels(GFiFo::access_t access) {
+    GFiFo fifo(4, 10, 8, 2, access);
+
+    GFiFo::fsm_levels_t _new;
+    GFiFo::fsm_levels_t _old;
+
+    push_to(fifo, 8);
+    pop_to(fifo, 7);
+    push_to(fifo, 8);
+
+    // NOTE: the consumer check comes first, it must not steal MAX
+    check(fifo.IsLevelChanged(GFiFo::CONSUMER_SIDE, &_new, &_old), "consumer sees its pop", access);
+    check(_old == GFiFo::MAX_LEVEL_PASSED && _new == GFiFo::REGULAR_LEVEL, "consumer sees MAX -> REGULAR", access);
+
+    check(fifo.IsLevelChanged(GFiFo::PRODUCER_SIDE, &_new, &_old), "producer sees its push", access);
+    check(_old == GFiFo::MIN_LEVEL_PASSED && _new == GFiFo::MAX_LEVEL_PASSED, "producer sees MIN -> MAX", access);
+
+    check(!fifo.IsLevelChanged(GFiFo::PRODUCER_SIDE), "producer transition reported once", access);
+    check(!fifo.IsLevelChanged(GFiFo::CONSUMER_SIDE), "consumer transition reported once", access);
+
+    pop_to(fifo, 2);
+
+    // NOTE: the producer check comes first, it must not steal MIN
+    check(!fifo.IsLevelChanged(GFiFo::PRODUCER_SIDE), "producer misses the pops", access);
+    check(fifo.IsLevelChanged(GFiFo::CONSUMER_SIDE, &_new, &_old), "consumer sees its pops", access);
+    check(_old == GFiFo::MAX_LEVEL_PASSED && _new == GFiFo::MIN_LEVEL_PASSED, "consumer sees MAX -> MIN", access);
+
+    check(fifo.fsm_level() == GFiFo::MIN_LEVEL_PASSED, "current level is MIN", access);
+}
+
+int main() {
+    test_levels(GFiFo::SPSC_ACCESS);
+    test_levels(GFiFo::MPMC_ACCESS);
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
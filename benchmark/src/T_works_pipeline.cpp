@@ -0,0 +1,117 @@
+
+#include "GWorksPipeline.hpp"
+
+#include <atomic>  // atomic
+#include <chrono>  // microseconds
+#include <cstdint> // uint32_t, uint64_t
+#include <cstdio>  // printf
+#include <thread>  // sleep_for
+
+// Three stage pipelines with several workers per stage: the uneven work times
+// make the workers finish (and push downstream) out of issue order, the sink
+// must still take every item once and in issue order, also when the source
+// ends the run (drain on done).
+#define ITEMS_NUM 500
+
+typedef struct item_t {
+    uint32_t id;
+    uint32_t stages; // NOTE: one bit per stage run on the item
+} item_t;
+
+typedef GWorksPipeline<item_t> pipeline_t;
+
+static int failures{0};
+
+static item_t   items[ITEMS_NUM];
+static uint32_t source_next;
+static uint32_t sink_next;
+static uint32_t single_next; // NOTE: input order seen by a single worker stage
+
+static void check(bool condition, const char* what, const char* run) {
+    if (!condition) {
+        printf("FAILED: %s (%s)\n", what, run);
+        failures++;
+    }
+}
+
+static void work(uint32_t id) {
+    std::this_thread::sleep_for(std::chrono::microseconds((id * 7) % 5 * 40));
+}
+
+static bool source(item_t*& item, bool& quit, std::any& args) {
+    if (source_next == ITEMS_NUM) {
+        return false;
+    }
+
+    item = &items[source_next];
+
+    item->id     = source_next++;
+    item->stages = 0;
+    return true;
+}
+
+template <uint32_t STAGE> static bool stage(item_t*& item, bool& quit, std::any& args) {
+    work(item->id + STAGE);
+    item->stages |= 1U << STAGE;
+    return true;
+}
+
+// NOTE: behind an IN_ORDER stage, a lone worker pops the items in issue order
+static bool single(item_t*& item, bool& quit, std::any& args) {
+    if (item->id == single_next) {
+        single_next++;
+    }
+    item->stages |= 1U << 1;
+    return true;
+}
+
+static bool sink(item_t*& item, bool& quit, std::any& args) {
+    check(item->id == sink_next, "sink in issue order", std::any_cast<const char*>(args));
+    check(item->stages == 0x7, "every stage run once", std::any_cast<const char*>(args));
+
+    sink_next = item->id + 1;
+    return true;
+}
+
+static void test_pipeline(const char* run, std::vector<pipeline_t::stage_t> stages, bool single_check) {
+    source_next = 0;
+    sink_next   = 0;
+    single_next = 0;
+
+    pipeline_t::work_func_t _work_func;
+
+    _work_func.source_calculus = source;
+    _work_func.sink_calculus   = sink;
+    _work_func.stages          = std::move(stages);
+
+    bool     _quit{false};
+    std::any _args{run};
+
+    pipeline_t _pipeline(_work_func, _quit, _args, 16);
+
+    // NOTE: no Close, the source returning false must drain the pipeline
+    _pipeline.Wait();
+
+    check(_pipeline.issued() == ITEMS_NUM, "every item issued", run);
+    check(_pipeline.sunk() == ITEMS_NUM, "every item sunk", run);
+    check(sink_next == ITEMS_NUM, "sink reached the last item", run);
+    check(!single_check || single_next == ITEMS_NUM, "single worker in issue order", run);
+}
+
+int main() {
+    pipeline_t::stage_t _in_order{nullptr, nullptr, nullptr, 3, pipeline_t::IN_ORDER};
+    pipeline_t::stage_t _any_order{nullptr, nullptr, nullptr, 3, pipeline_t::ANY_ORDER};
+    pipeline_t::stage_t _single{single, nullptr, nullptr, 1, pipeline_t::IN_ORDER};
+
+    auto __stage = [](pipeline_t::stage_t base, pipeline_t::ItemFunc calculus) {
+        base.calculus = calculus;
+        return base;
+    };
+
+    test_pipeline("ANY -> ANY -> ANY", {__stage(_any_order, stage<0>), __stage(_any_order, stage<1>), __stage(_any_order, stage<2>)}, false);
+    test_pipeline("ANY -> IN -> ANY", {__stage(_any_order, stage<0>), __stage(_in_order, stage<1>), __stage(_any_order, stage<2>)}, false);
+    test_pipeline("IN -> single -> ANY", {__stage(_in_order, stage<0>), _single, __stage(_any_order, stage<2>)}, true);
+
+    printf("%s\n", failures == 0 ? "PASSED" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -11,12 +11,20 @@
 
 #include "GOptions.hpp"
 
+// SECTION: Process global variables
+bool           MEMORY_LOCK_ENABLED = false;
+unsigned int   MEMORY_STACK_BYTES  = 262144;
+bool           START_SYNC_ENABLED  = false;
+unsigned int   START_SYNC_TIMEOUT  = 1000;
+
 // SECTION: PL_to_PS global variables
 bool           RX_MODE_ENABLED     = true;
 unsigned int   RX_MODE_LOOPS       = 20;
 std::string    RX_FILE_NAME        = "rx_words.bin";
+unsigned int   RX_FILE_SEGMENT     = 1024;
 unsigned int   RX_STREAM_ID        = 1;
 unsigned char  RX_STREAM_TYPE      = 1;
+unsigned char  RX_STREAM_CODEC     = 0;
 std::string    RX_CLIENT_ADDR      = "127.0.0.1";
 unsigned short RX_CLIENT_PORT      = 30001;
 unsigned int   RX_PACKET_WORDS     = 1024;
@@ -28,11 +36,21 @@ int            RX_FIFO_UIO_MAP     = 1;
 unsigned int   RX_ROLLER_NUMBER    = 20;
 int            RX_ROLLER_MAX_LEVEL = -1;
 int            RX_ROLLER_MIM_LEVEL = -1;
+std::string    RX_CHECK_MODE       = "";
+unsigned int   RX_CHECK_VALUE      = 1;
+unsigned int   RX_MONITOR_WINDOW   = 0;
+std::string    RX_MASTER_THREAD    = "";
+std::string    RX_WAITER_THREAD    = "";
+std::string    RX_WAITER_WAIT      = "";
 
 // SECTION: PS_to_PL global variables
 bool           TX_MODE_ENABLED     = true;
 unsigned int   TX_MODE_LOOPS       = 20;
 std::string    TX_FILE_NAME        = "tx_words.bin";
+bool           TX_FILE_LOOP        = true;
+double         TX_FILE_RATE        = 0.0;
+std::string    TX_FILE_MODE        = "";
+double         TX_FILE_SPEED       = 1.0;
 unsigned int   TX_STREAM_ID        = 2;
 unsigned char  TX_STREAM_TYPE      = 2;
 std::string    TX_SERVER_ADDR      = "127.0.0.1";
@@ -47,6 +65,13 @@ int            TX_FIFO_UIO_MAP     = 2;
 unsigned int   TX_ROLLER_NUMBER    = 20;
 int            TX_ROLLER_MAX_LEVEL = -1;
 int            TX_ROLLER_MIM_LEVEL = -1;
+std::string    TX_PATTERN_MODE     = "";
+unsigned int   TX_PATTERN_VALUE    = 1;
+unsigned int   TX_PATTERN_LEVEL    = 1448;
+double         TX_PATTERN_TONE     = 0.125;
+std::string    TX_MASTER_THREAD    = "";
+std::string    TX_WAITER_THREAD    = "";
+std::string    TX_WAITER_WAIT      = "";
 
 // =============================================================================
 
@@ -55,11 +80,18 @@ namespace Global {
 
     static void __options_set(GOptions& opts) {
         // clang-format off
+        GOPTIONS_SET(opts, "Process" , MEMORY_LOCK_ENABLED);
+        GOPTIONS_SET(opts, "Process" , MEMORY_STACK_BYTES );
+        GOPTIONS_SET(opts, "Process" , START_SYNC_ENABLED );
+        GOPTIONS_SET(opts, "Process" , START_SYNC_TIMEOUT );
+
         GOPTIONS_SET(opts, "PL_to_PS", RX_MODE_ENABLED    );
         GOPTIONS_SET(opts, "PL_to_PS", RX_MODE_LOOPS      );
         GOPTIONS_SET(opts, "PL_to_PS", RX_FILE_NAME       );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_FILE_SEGMENT    );
         GOPTIONS_SET(opts, "PL_to_PS", RX_STREAM_ID       );
         GOPTIONS_SET(opts, "PL_to_PS", RX_STREAM_TYPE     );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_STREAM_CODEC    );
         GOPTIONS_SET(opts, "PL_to_PS", RX_CLIENT_ADDR     );
         GOPTIONS_SET(opts, "PL_to_PS", RX_CLIENT_PORT     );
         GOPTIONS_SET(opts, "PL_to_PS", RX_PACKET_WORDS    );
@@ -71,10 +103,20 @@ namespace Global {
         GOPTIONS_SET(opts, "PL_to_PS", RX_ROLLER_NUMBER   );
         GOPTIONS_SET(opts, "PL_to_PS", RX_ROLLER_MAX_LEVEL);
         GOPTIONS_SET(opts, "PL_to_PS", RX_ROLLER_MIM_LEVEL);
+        GOPTIONS_SET(opts, "PL_to_PS", RX_CHECK_MODE      );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_CHECK_VALUE     );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_MONITOR_WINDOW  );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_MASTER_THREAD   );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_WAITER_THREAD   );
+        GOPTIONS_SET(opts, "PL_to_PS", RX_WAITER_WAIT     );
         
         GOPTIONS_SET(opts, "PS_to_PL", TX_MODE_ENABLED    );
         GOPTIONS_SET(opts, "PS_to_PL", TX_MODE_LOOPS      );
         GOPTIONS_SET(opts, "PS_to_PL", TX_FILE_NAME       );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_FILE_LOOP       );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_FILE_RATE       );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_FILE_MODE       );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_FILE_SPEED      );
         GOPTIONS_SET(opts, "PS_to_PL", TX_STREAM_ID       );
         GOPTIONS_SET(opts, "PS_to_PL", TX_STREAM_TYPE     );
         GOPTIONS_SET(opts, "PS_to_PL", TX_SERVER_ADDR     );
@@ -89,16 +131,30 @@ namespace Global {
         GOPTIONS_SET(opts, "PS_to_PL", TX_ROLLER_NUMBER   );
         GOPTIONS_SET(opts, "PS_to_PL", TX_ROLLER_MAX_LEVEL);
         GOPTIONS_SET(opts, "PS_to_PL", TX_ROLLER_MIM_LEVEL);
+        GOPTIONS_SET(opts, "PS_to_PL", TX_PATTERN_MODE    );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_PATTERN_VALUE   );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_PATTERN_LEVEL   );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_PATTERN_TONE    );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_MASTER_THREAD   );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_WAITER_THREAD   );
+        GOPTIONS_SET(opts, "PS_to_PL", TX_WAITER_WAIT     );
         // clang-format on
     }
 
     static void __options_get(GOptions& opts) {
         // clang-format off
+        GOPTIONS_GET(opts, "Process" , MEMORY_LOCK_ENABLED);
+        GOPTIONS_GET(opts, "Process" , MEMORY_STACK_BYTES );
+        GOPTIONS_GET(opts, "Process" , START_SYNC_ENABLED );
+        GOPTIONS_GET(opts, "Process" , START_SYNC_TIMEOUT );
+
         GOPTIONS_GET(opts, "PL_to_PS", RX_MODE_ENABLED    );
         GOPTIONS_GET(opts, "PL_to_PS", RX_MODE_LOOPS      );
         GOPTIONS_GET(opts, "PL_to_PS", RX_FILE_NAME       );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_FILE_SEGMENT    );
         GOPTIONS_GET(opts, "PL_to_PS", RX_STREAM_ID       );
         GOPTIONS_GET(opts, "PL_to_PS", RX_STREAM_TYPE     );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_STREAM_CODEC    );
         GOPTIONS_GET(opts, "PL_to_PS", RX_CLIENT_ADDR     );
         GOPTIONS_GET(opts, "PL_to_PS", RX_CLIENT_PORT     );
         GOPTIONS_GET(opts, "PL_to_PS", RX_PACKET_WORDS    );
@@ -110,10 +166,20 @@ namespace Global {
         GOPTIONS_GET(opts, "PL_to_PS", RX_ROLLER_NUMBER   );
         GOPTIONS_GET(opts, "PL_to_PS", RX_ROLLER_MAX_LEVEL);
         GOPTIONS_GET(opts, "PL_to_PS", RX_ROLLER_MIM_LEVEL);
+        GOPTIONS_GET(opts, "PL_to_PS", RX_CHECK_MODE      );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_CHECK_VALUE     );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_MONITOR_WINDOW  );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_MASTER_THREAD   );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_WAITER_THREAD   );
+        GOPTIONS_GET(opts, "PL_to_PS", RX_WAITER_WAIT     );
         
         GOPTIONS_GET(opts, "PS_to_PL", TX_MODE_ENABLED    );
         GOPTIONS_GET(opts, "PS_to_PL", TX_MODE_LOOPS      );
         GOPTIONS_GET(opts, "PS_to_PL", TX_FILE_NAME       );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_FILE_LOOP       );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_FILE_RATE       );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_FILE_MODE       );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_FILE_SPEED      );
         GOPTIONS_GET(opts, "PS_to_PL", TX_STREAM_ID       );
         GOPTIONS_GET(opts, "PS_to_PL", TX_STREAM_TYPE     );
         GOPTIONS_GET(opts, "PS_to_PL", TX_SERVER_ADDR     );
@@ -128,6 +194,13 @@ namespace Global {
         GOPTIONS_GET(opts, "PS_to_PL", TX_ROLLER_NUMBER   );
         GOPTIONS_GET(opts, "PS_to_PL", TX_ROLLER_MAX_LEVEL);
         GOPTIONS_GET(opts, "PS_to_PL", TX_ROLLER_MIM_LEVEL);
+        GOPTIONS_GET(opts, "PS_to_PL", TX_PATTERN_MODE    );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_PATTERN_VALUE   );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_PATTERN_LEVEL   );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_PATTERN_TONE    );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_MASTER_THREAD   );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_WAITER_THREAD   );
+        GOPTIONS_GET(opts, "PS_to_PL", TX_WAITER_WAIT     );
         // clang-format on
     }
 
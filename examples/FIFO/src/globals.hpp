@@ -11,6 +11,7 @@
 #define GLOBALS_HPP
 
 #include "GArrayRoller.hpp"
+#include "GBarrier.hpp"
 #include "GFIFOdevice.hpp"
 #include "GProfile.hpp"
 #include "GUdpClient.hpp"
@@ -19,12 +20,20 @@
 
 #define FIFO_WORD_SIZE sizeof(uint16_t)
 
+// SECTION: Process global variables
+extern bool           MEMORY_LOCK_ENABLED;
+extern unsigned int   MEMORY_STACK_BYTES;
+extern bool           START_SYNC_ENABLED;
+extern unsigned int   START_SYNC_TIMEOUT;
+
 // SECTION: PL_to_PS global variables
 extern bool           RX_MODE_ENABLED;
 extern unsigned int   RX_MODE_LOOPS;
 extern std::string    RX_FILE_NAME;
+extern unsigned int   RX_FILE_SEGMENT;
 extern unsigned int   RX_STREAM_ID;
 extern unsigned char  RX_STREAM_TYPE;
+extern unsigned char  RX_STREAM_CODEC;
 extern std::string    RX_CLIENT_ADDR;
 extern unsigned short RX_CLIENT_PORT;
 extern unsigned int   RX_PACKET_WORDS;
@@ -36,11 +45,21 @@ extern int            RX_FIFO_UIO_MAP;
 extern unsigned int   RX_ROLLER_NUMBER;
 extern int            RX_ROLLER_MAX_LEVEL;
 extern int            RX_ROLLER_MIM_LEVEL;
+extern std::string    RX_CHECK_MODE;
+extern unsigned int   RX_CHECK_VALUE;
+extern unsigned int   RX_MONITOR_WINDOW;
+extern std::string    RX_MASTER_THREAD;
+extern std::string    RX_WAITER_THREAD;
+extern std::string    RX_WAITER_WAIT;
 
 // SECTION: PS_to_PL global variables
 extern bool           TX_MODE_ENABLED;
 extern unsigned int   TX_MODE_LOOPS;
 extern std::string    TX_FILE_NAME;
+extern bool           TX_FILE_LOOP;
+extern double         TX_FILE_RATE;
+extern std::string    TX_FILE_MODE;
+extern double         TX_FILE_SPEED;
 extern unsigned int   TX_STREAM_ID;
 extern unsigned char  TX_STREAM_TYPE;
 extern std::string    TX_SERVER_ADDR;
@@ -55,6 +74,13 @@ extern int            TX_FIFO_UIO_MAP;
 extern unsigned int   TX_ROLLER_NUMBER;
 extern int            TX_ROLLER_MAX_LEVEL;
 extern int            TX_ROLLER_MIM_LEVEL;
+extern std::string    TX_PATTERN_MODE;
+extern unsigned int   TX_PATTERN_VALUE;
+extern unsigned int   TX_PATTERN_LEVEL;
+extern double         TX_PATTERN_TONE;
+extern std::string    TX_MASTER_THREAD;
+extern std::string    TX_WAITER_THREAD;
+extern std::string    TX_WAITER_WAIT;
 
 // =============================================================================
 
@@ -75,6 +101,7 @@ typedef struct worker_args_t {
     g_fifo_device_t*  device        = nullptr;
     g_array_roller_t* roller        = nullptr;
     g_profile_t*      profile       = nullptr;
+    GBarrier*         start_sync    = nullptr; // NOTE: shared by the masters
 
 } worker_args_t;
 
@@ -8,6 +8,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "GString.hpp"
+#include "monitor.hpp"
+#include "patterns.hpp"
 #include "streams.hpp"
 
 #include <filesystem> // path
@@ -21,12 +23,48 @@
          ╚═══════════════════════╝
 */
 
+// =============================================================================
+// MEMORY functions
+// =============================================================================
+
+static thread_local memory_faults_t faults_origin;
+
+// NOTE: at the end of a preamble, the faults of the streaming are counted from here
+static void memory_preamble() {
+    DO_IF(MEMORY_LOCK_ENABLED, GMemory::PrefaultStack(MEMORY_STACK_BYTES));
+
+    faults_origin = GMemory::Faults();
+}
+
+static void memory_epilogue(const char* tag) {
+    auto _faults{GMemory::Faults()};
+
+    LOG_FORMAT(info, "[STATS] %s page faults: %ld/%ld (minor/major)", tag, _faults.minor - faults_origin.minor, _faults.major - faults_origin.major);
+}
+
+// =============================================================================
+// START functions
+// =============================================================================
+
+// NOTE: the masters of the enabled channels start streaming together
+static void start_sync(worker_args_t* worker_args, const char* tag) {
+    auto* barrier{worker_args->start_sync};
+
+    RETURN_IF(barrier == nullptr, );
+
+    auto _synced{barrier->ArriveAndWait(std::chrono::milliseconds(START_SYNC_TIMEOUT))};
+
+    LOG_IF(!_synced, warning, "%s master started unsynced, timeout %u ms (%s)", tag, START_SYNC_TIMEOUT, __func__);
+}
+
 // =============================================================================
 // RX WAITER functions
 // =============================================================================
 
 static void rx_waiter_preamble(bool& _quit, std::any& _args) {
     LOG_WRITE(trace, "Thread STARTED (PS -> STREAM)");
+
+    memory_preamble();
 }
 
 static void rx_waiter_consumer(bool& _quit, std::any& _args) {
@@ -42,6 +80,10 @@ static void rx_waiter_consumer(bool& _quit, std::any& _args) {
     auto* src_buf{roller->Reading_Start(_error)};
     GOTO_IF_BUT(_error, _exit_label, _line = __LINE__);
 
+    DO_BLOCK_IF(rx_check_is_enabled(), rx_check_array(src_buf));
+
+    DO_BLOCK_IF(rx_monitor_is_enabled(), rx_monitor_array(src_buf));
+
     _error = !stream_writer_for_rx_words(src_buf, client, server);
     GOTO_IF_BUT(_error, _exit_label, _line = __LINE__);
 
@@ -56,6 +98,40 @@ _exit_label:
 }
 
 static void rx_waiter_epilogue(bool& _quit, std::any& _args) {
+    if (rx_check_is_enabled()) {
+        const auto& _stats{rx_check_get_stats()};
+
+        LOG_FORMAT(info, "[STATS] CHK arrays/words: %lu/%lu", _stats.arrays, _stats.words);
+        LOG_FORMAT(info, "[STATS] CHK bit errors  : %lu (words: %lu)", _stats.bit_errors, _stats.word_errors);
+        LOG_FORMAT(info, "[STATS] CHK slips count : %lu", _stats.slips);
+        LOG_FORMAT(info, "[STATS] CHK gaps count  : %lu (lost words: %lu)", _stats.gaps, _stats.lost_words);
+    }
+
+    rx_monitor_snapshot_t _snapshot;
+
+    if (rx_monitor_is_enabled() && rx_monitor_get_snapshot(&_snapshot)) {
+        const auto& _window{_snapshot.windows > 0 ? _snapshot.window : _snapshot.array};
+
+        LOG_FORMAT(info, "[STATS] MON windows count: %llu", (unsigned long long)_snapshot.windows);
+        LOG_FORMAT(info, "[STATS] MON DC offset I/Q: %0.2f/%0.2f", _window.dc_i, _window.dc_q);
+        LOG_FORMAT(info, "[STATS] MON mean power   : %0.1f", _window.power);
+        LOG_FORMAT(info, "[STATS] MON peak value   : %0.1f", _window.peak);
+    }
+
+    // NOTE: the recorder exists in FILE streaming only, pending arrays are written here
+    if (stream_recorder != nullptr) {
+        stream_recorder->Stop();
+
+        LOG_FORMAT(info, "[STATS] REC records count: %llu", (unsigned long long)stream_recorder->records());
+        LOG_FORMAT(info, "[STATS] REC dropped count: %llu", (unsigned long long)stream_recorder->dropped());
+    }
+
+    // NOTE: the codec exists in UDP streaming only
+    DO_BLOCK_IF(stream_codec != nullptr && stream_codec->raw_bytes() > 0, //
+                LOG_FORMAT(info, "[STATS] RX codec ratio: %0.3f", (double)stream_codec->coded_bytes() / (double)stream_codec->raw_bytes()));
+
+    memory_epilogue("RX waiter");
+
     LOG_WRITE(trace, "Thread STOPPED (PS -> STREAM)");
 }
 
@@ -82,6 +158,9 @@ static void rx_master_preamble(bool& _quit, std::any& _args) {
     _error = !device->ClearEvent();
     GOTO_IF_BUT(_error, _exit_label, _line = __LINE__);
 
+    memory_preamble();
+    start_sync(worker_args, "RX");
+
     profile->Start();
     return;
 
@@ -155,6 +234,8 @@ static void rx_master_epilogue(bool& _quit, std::any& _args) {
     LOG_FORMAT(info, "[STATS] RX loops counter: %lu", loops_counter);
     LOG_FORMAT(info, "[STATS] RX average speed: %0.3f %s", _speed.first, _speed.second.c_str());
 
+    memory_epilogue("RX master");
+
     LOG_WRITE(trace, "Thread STOPPED (PL -> PS)");
 }
 
@@ -190,6 +271,8 @@ static void tx_waiter_preamble(bool& _quit, std::any& _args) {
     _error = !device->ClearEvent();
     GOTO_IF_BUT(_error, _exit_label, _line = __LINE__);
 
+    memory_preamble();
+
     profile->Start();
     return;
 
@@ -251,6 +334,8 @@ static void tx_waiter_epilogue(bool& _quit, std::any& _args) {
     LOG_FORMAT(info, "[STATS] TX loops counter: %lu", loops_counter);
     LOG_FORMAT(info, "[STATS] TX average speed: %0.3f %s", _speed.first, _speed.second.c_str());
 
+    memory_epilogue("TX waiter");
+
     LOG_WRITE(trace, "Thread STOPPED (PL <- PS)");
 }
 
@@ -260,6 +345,9 @@ static void tx_waiter_epilogue(bool& _quit, std::any& _args) {
 
 static void tx_master_preamble(bool& _quit, std::any& _args) {
     LOG_WRITE(trace, "Thread STARTED (PS <- STREAM)");
+
+    memory_preamble();
+    start_sync(std::any_cast<worker_args_t*>(_args), "TX");
 }
 
 static void tx_master_producer(bool& _quit, std::any& _args) {
@@ -298,9 +386,27 @@ _exit_label:
 }
 
 static void tx_master_epilogue(bool& _quit, std::any& _args) {
-    LOG_FORMAT(info, "[STATS] DEC packet count: %u", stream_decoder->message.PacketCounter());
-    LOG_FORMAT(info, "[STATS] DEC errors count: %u", stream_decoder->message.ErrorsCounter());
-    LOG_FORMAT(info, "[STATS] DEC missed count: %u", stream_decoder->message.MissedCounter());
+    // NOTE: the decoder exists in UDP streaming only
+    DO_BLOCK_IF(stream_decoder != nullptr, //
+                LOG_FORMAT(info, "[STATS] DEC packet count: %u", stream_decoder->message.PacketCounter());
+                LOG_FORMAT(info, "[STATS] DEC errors count: %u", stream_decoder->message.ErrorsCounter());
+                LOG_FORMAT(info, "[STATS] DEC missed count: %u", stream_decoder->message.MissedCounter()));
+
+    // NOTE: the player exists in FILE streaming only
+    DO_BLOCK_IF(stream_player != nullptr, //
+                LOG_FORMAT(info, "[STATS] PLY words count: %llu", (unsigned long long)stream_player->words());
+                LOG_FORMAT(info, "[STATS] PLY loops count: %llu", (unsigned long long)stream_player->loops());
+                LOG_FORMAT(info, "[STATS] PLY late  count: %llu", (unsigned long long)stream_player->late()));
+
+    // NOTE: the capture exists in FILE streaming only (TX_FILE_MODE "capture")
+    DO_BLOCK_IF(stream_capture != nullptr, //
+                LOG_FORMAT(info, "[STATS] CAP replayed  count: %llu", (unsigned long long)stream_capture->replayed());
+                LOG_FORMAT(info, "[STATS] CAP lost      count: %llu", (unsigned long long)stream_capture->lost());
+                LOG_FORMAT(info, "[STATS] CAP corrupted count: %llu", (unsigned long long)stream_capture->corrupted());
+                LOG_FORMAT(info, "[STATS] CAP late      count: %llu", (unsigned long long)stream_capture->late());
+                LOG_FORMAT(info, "[STATS] CAP loops     count: %llu", (unsigned long long)stream_capture->loops()));
+
+    memory_epilogue("TX master");
 
     LOG_WRITE(trace, "Thread STOPPED (PS <- STREAM)");
 }
@@ -319,6 +425,11 @@ int main(int argc, char* argv[]) {
 
     Global::load_options(exec_cfg);
 
+    if ((TX_MODE_ENABLED && !tx_pattern_init()) || (RX_MODE_ENABLED && (!rx_check_init() || !rx_monitor_init()))) {
+        LOG_FORMAT(trace, "Process STOPPED (%s)", exec.stem().c_str());
+        return 1;
+    }
+
     // SECTION: functions handles
 
     GWorksCoupler::work_func_t work_func_rx;
@@ -337,6 +448,29 @@ int main(int argc, char* argv[]) {
     work_func_tx.master_calculus = tx_master_producer;
     work_func_tx.master_epilogue = tx_master_epilogue;
 
+    // SECTION: threads scheduling
+
+    work_func_rx.waiter_thread.name = "rx_waiter";
+    work_func_rx.master_thread.name = "rx_master";
+    work_func_tx.waiter_thread.name = "tx_waiter";
+    work_func_tx.master_thread.name = "tx_master";
+
+    if (!GThread::Parse(RX_WAITER_THREAD, &work_func_rx.waiter_thread) || !GThread::Parse(RX_MASTER_THREAD, &work_func_rx.master_thread) || //
+        !GThread::Parse(TX_WAITER_THREAD, &work_func_tx.waiter_thread) || !GThread::Parse(TX_MASTER_THREAD, &work_func_tx.master_thread)) {
+        LOG_FORMAT(trace, "Process STOPPED (%s)", exec.stem().c_str());
+        return 1;
+    }
+
+    GThread::CheckPrivileges({work_func_rx.waiter_thread, work_func_rx.master_thread, work_func_tx.waiter_thread, work_func_tx.master_thread});
+
+    // SECTION: waiters strategies
+
+    if (!GWait::Parse(RX_WAITER_WAIT, &work_func_rx.waiter_wait) || !GWait::Parse(TX_WAITER_WAIT, &work_func_tx.waiter_wait)) {
+        LOG_FORMAT(error, "Invalid wait strategy \"%s\" or \"%s\" (%s)", RX_WAITER_WAIT.c_str(), TX_WAITER_WAIT.c_str(), __func__);
+        LOG_FORMAT(trace, "Process STOPPED (%s)", exec.stem().c_str());
+        return 1;
+    }
+
     // SECTION: worker parameters
 
     auto rx_client{g_udp_client_t(RX_CLIENT_ADDR.c_str(), RX_CLIENT_PORT, RX_FIFO_TAG_NAME.c_str())};
@@ -348,9 +482,20 @@ int main(int argc, char* argv[]) {
     auto rx_roller{g_array_roller_t(RX_PACKET_WORDS, RX_ROLLER_NUMBER, RX_FIFO_TAG_NAME, RX_ROLLER_MAX_LEVEL, RX_ROLLER_MIM_LEVEL)};
     auto tx_roller{g_array_roller_t(TX_PACKET_WORDS, TX_ROLLER_NUMBER, TX_FIFO_TAG_NAME, TX_ROLLER_MAX_LEVEL, TX_ROLLER_MIM_LEVEL)};
 
+    // NOTE: opt-in, the pages of the rollers (and of everything after) are resident before streaming
+    if (MEMORY_LOCK_ENABLED) {
+        GMemory::LockAll();
+
+        DO_IF(RX_MODE_ENABLED, rx_roller.Prefault());
+        DO_IF(TX_MODE_ENABLED, tx_roller.Prefault());
+    }
+
     g_profile_t rx_profile;
     g_profile_t tx_profile;
 
+    // NOTE: opt-in, one participant per enabled channel (spinning first, for the least skew)
+    GBarrier start_barrier(static_cast<unsigned>(RX_MODE_ENABLED) + static_cast<unsigned>(TX_MODE_ENABLED), {WAIT_SPIN_PARK});
+
     worker_args_t worker_args_rx;
     worker_args_rx.total_loops = RX_MODE_LOOPS;
     worker_args_rx.client      = &rx_client;
@@ -358,6 +503,7 @@ int main(int argc, char* argv[]) {
     worker_args_rx.device      = &rx_device;
     worker_args_rx.roller      = &rx_roller;
     worker_args_rx.profile     = &rx_profile;
+    worker_args_rx.start_sync  = START_SYNC_ENABLED ? &start_barrier : nullptr;
 
     worker_args_t worker_args_tx;
     worker_args_tx.total_loops = TX_MODE_LOOPS;
@@ -366,6 +512,7 @@ int main(int argc, char* argv[]) {
     worker_args_tx.device      = &tx_device;
     worker_args_tx.roller      = &tx_roller;
     worker_args_tx.profile     = &tx_profile;
+    worker_args_tx.start_sync  = START_SYNC_ENABLED ? &start_barrier : nullptr;
 
     auto args_rx = std::any(&worker_args_rx);
     auto args_tx = std::any(&worker_args_tx);
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      monitor.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "monitor.hpp"
+
+#include <algorithm> // max
+#include <atomic>    // atomic, atomic_thread_fence
+#include <chrono>    // milliseconds, steady_clock
+#include <cmath>     // sqrt
+#include <cstring>   // memcpy
+
+typedef struct monitor_sums {
+    uint64_t pairs;
+    int64_t  sum_i;
+    int64_t  sum_q;
+    int64_t  sum_p;
+    int32_t  max_p;
+} monitor_sums_t;
+
+static bool                                  monitor_enabled{false};
+static std::chrono::milliseconds             monitor_window;
+static std::chrono::steady_clock::time_point monitor_start;
+static monitor_sums_t                        monitor_total;
+static rx_monitor_snapshot_t                 monitor_state;
+
+// SECTION: seqlock (single writer: the rx waiter)
+
+#define MONITOR_WORDS (sizeof(rx_monitor_snapshot_t) / sizeof(uint64_t))
+
+static_assert(sizeof(rx_monitor_snapshot_t) % sizeof(uint64_t) == 0, "Snapshot not made of 64-bit words.");
+
+static std::atomic<uint32_t> monitor_seq{0};
+static std::atomic<uint64_t> monitor_words[MONITOR_WORDS];
+
+static void __publish(const rx_monitor_snapshot_t& snapshot) {
+    uint64_t _words[MONITOR_WORDS];
+    memcpy(_words, &snapshot, sizeof(_words));
+
+    auto _seq{monitor_seq.load(std::memory_order_relaxed)};
+
+    monitor_seq.store(_seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i{0}; i < MONITOR_WORDS; ++i) {
+        monitor_words[i].store(_words[i], std::memory_order_relaxed);
+    }
+
+    monitor_seq.store(_seq + 2, std::memory_order_release);
+}
+
+bool rx_monitor_get_snapshot(rx_monitor_snapshot_t* snapshot) {
+    uint64_t _words[MONITOR_WORDS];
+    uint32_t _seq_1;
+    uint32_t _seq_2;
+
+    do {
+        _seq_1 = monitor_seq.load(std::memory_order_acquire);
+
+        for (size_t i{0}; i < MONITOR_WORDS; ++i) {
+            _words[i] = monitor_words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        _seq_2 = monitor_seq.load(std::memory_order_relaxed);
+    } while ((_seq_1 & 1) != 0 || _seq_1 != _seq_2);
+
+    memcpy(snapshot, _words, sizeof(_words));
+    return _seq_1 != 0;
+}
+
+// SECTION: statistics
+
+// NOTE: single pass, branch-free: the compiler vectorizes the reductions
+static monitor_sums_t __accumulate(const uint16_t* src, size_t pairs) {
+    int64_t _sum_i{0};
+    int64_t _sum_q{0};
+    int64_t _sum_p{0};
+    int32_t _max_p{0};
+
+    for (size_t n{0}; n < pairs; ++n) {
+        int32_t _i{(int16_t)(uint16_t)(src[2 * n + 0] << 4) >> 4};
+        int32_t _q{(int16_t)(uint16_t)(src[2 * n + 1] << 4) >> 4};
+        int32_t _p{_i * _i + _q * _q};
+
+        _sum_i += _i;
+        _sum_q += _q;
+        _sum_p += _p;
+        _max_p  = std::max(_max_p, _p);
+    }
+    return {pairs, _sum_i, _sum_q, _sum_p, _max_p};
+}
+
+static rx_monitor_metrics_t __metrics(const monitor_sums_t& sums) {
+    if (sums.pairs == 0) {
+        return {};
+    }
+
+    auto _pairs{(double)sums.pairs};
+
+    return {sums.pairs, (double)sums.sum_i / _pairs, (double)sums.sum_q / _pairs, (double)sums.sum_p / _pairs, std::sqrt((double)sums.max_p)};
+}
+
+bool rx_monitor_init() {
+    monitor_enabled = RX_MONITOR_WINDOW > 0;
+    monitor_window  = std::chrono::milliseconds(RX_MONITOR_WINDOW);
+    monitor_start   = std::chrono::steady_clock::now();
+    monitor_total   = {};
+    monitor_state   = {};
+
+    if (monitor_enabled) {
+        LOG_FORMAT(info, "RX monitor enabled [window: %u ms] (%s)", RX_MONITOR_WINDOW, __func__);
+    }
+    return true;
+}
+
+bool rx_monitor_is_enabled() {
+    return monitor_enabled;
+}
+
+void rx_monitor_array(const g_array_t* array) {
+    auto _sums{__accumulate(array->data(), array->used() / 2)};
+
+    monitor_total.pairs += _sums.pairs;
+    monitor_total.sum_i += _sums.sum_i;
+    monitor_total.sum_q += _sums.sum_q;
+    monitor_total.sum_p += _sums.sum_p;
+    monitor_total.max_p  = std::max(monitor_total.max_p, _sums.max_p);
+
+    monitor_state.arrays++;
+    monitor_state.array = __metrics(_sums);
+
+    auto _now{std::chrono::steady_clock::now()};
+
+    if (_now - monitor_start >= monitor_window) {
+        monitor_state.windows++;
+        monitor_state.window = __metrics(monitor_total);
+
+        monitor_total = {};
+        monitor_start = _now;
+    }
+
+    __publish(monitor_state);
+}
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      monitor.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MONITOR_HPP
+#define MONITOR_HPP
+
+#include "globals.hpp"
+
+// NOTE: words are AD9361 samples (12-bit, sign extended) interleaved as I, Q
+
+typedef struct rx_monitor_metrics {
+    uint64_t pairs;
+    double   dc_i;  // mean of I
+    double   dc_q;  // mean of Q
+    double   power; // mean of I^2 + Q^2
+    double   peak;  // maximum of sqrt(I^2 + Q^2)
+} rx_monitor_metrics_t;
+
+typedef struct rx_monitor_snapshot {
+    uint64_t             arrays;  // arrays seen since the start
+    uint64_t             windows; // windows closed since the start
+    rx_monitor_metrics_t array;   // last array
+    rx_monitor_metrics_t window;  // last closed window
+} rx_monitor_snapshot_t;
+
+bool rx_monitor_init();
+
+bool rx_monitor_is_enabled();
+
+void rx_monitor_array(const g_array_t* array);
+
+// NOTE: lock-free, callable from any thread (false before the first array)
+bool rx_monitor_get_snapshot(rx_monitor_snapshot_t* snapshot);
+
+#endif // MONITOR_HPP
@@ -0,0 +1,408 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      patterns.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "patterns.hpp"
+
+#include <algorithm> // min
+#include <bit>       // popcount
+#include <cmath>     // cos, fmod, llround, lround
+#include <numbers>   // pi
+#include <vector>    // vector
+
+#define SAMPLE_BITS 12
+#define SAMPLE_MASK ((1U << SAMPLE_BITS) - 1)
+#define NCO_BITS    12 // phase to amplitude table resolution
+
+typedef enum {
+    PATTERN_OFF,
+    PATTERN_PRBS,
+    PATTERN_RAMP,
+    PATTERN_CONST,
+    PATTERN_TONE
+
+} pattern_mode_t;
+
+// PRBS polynomials x^n + x^m + 1 (ITU-T O.150)
+static const struct {
+    const char* name;
+    uint32_t    n;
+    uint32_t    m;
+} prbs_table[]{
+    {"prbs7", 7, 6},
+    {"prbs15", 15, 14},
+    {"prbs23", 23, 18},
+    {"prbs31", 31, 28},
+};
+
+static pattern_mode_t pattern_mode{PATTERN_OFF};
+static uint32_t       prbs_n;
+static uint32_t       prbs_m;
+static uint32_t       prbs_state;
+static uint32_t       ramp_value;
+static uint32_t       nco_phase;
+static uint32_t       nco_step;
+static int16_t        nco_table[1 << NCO_BITS];
+
+static inline uint16_t __sample(uint32_t value) {
+    // sign extension of the 12-bit sample
+    return (uint16_t)((int16_t)(uint16_t)(value << (16 - SAMPLE_BITS)) >> (16 - SAMPLE_BITS));
+}
+
+// Next 'bits' of the sequence s[t] = s[t-m] ^ s[t-n], with bits <= m: the whole
+// block depends on the history only, so it is computed with two shifts.
+static inline uint32_t __prbs_block(uint32_t bits) {
+    auto _block{((prbs_state >> (prbs_m - bits)) ^ (prbs_state >> (prbs_n - bits))) & ((1U << bits) - 1)};
+
+    prbs_state = ((prbs_state << bits) | _block) & ((1U << prbs_n) - 1);
+    return _block;
+}
+
+static void __fill_prbs(uint16_t* dst, size_t words) {
+    if (prbs_m >= SAMPLE_BITS) {
+        for (size_t i{0}; i < words; ++i) {
+            dst[i] = __sample(__prbs_block(SAMPLE_BITS));
+        }
+        return;
+    }
+
+    for (size_t i{0}; i < words; ++i) {
+        auto _hi{__prbs_block(SAMPLE_BITS / 2)};
+        auto _lo{__prbs_block(SAMPLE_BITS / 2)};
+
+        dst[i] = __sample((_hi << (SAMPLE_BITS / 2)) | _lo);
+    }
+}
+
+static void __fill_ramp(uint16_t* dst, size_t words) {
+    const auto _step{TX_PATTERN_VALUE};
+
+    for (size_t i{0}; i < words; ++i) {
+        dst[i] = __sample(ramp_value + (uint32_t)i * _step);
+    }
+    ramp_value += (uint32_t)words * _step;
+}
+
+static void __fill_const(uint16_t* dst, size_t words) {
+    const auto _word{__sample(TX_PATTERN_VALUE)};
+
+    for (size_t i{0}; i < words; ++i) {
+        dst[i] = _word;
+    }
+}
+
+static void __fill_tone(uint16_t* dst, size_t words) {
+    const uint32_t _quarter{1U << (NCO_BITS - 2)};
+
+    for (size_t i{0}; i + 1 < words; i += 2) {
+        auto _index{nco_phase >> (32 - NCO_BITS)};
+
+        dst[i + 0] = (uint16_t)nco_table[_index];                                        // I: cos
+        dst[i + 1] = (uint16_t)nco_table[(_index - _quarter) & ((1U << NCO_BITS) - 1)]; // Q: sin
+        nco_phase += nco_step;
+    }
+}
+
+bool tx_pattern_init() {
+    pattern_mode = PATTERN_OFF;
+
+    if (TX_PATTERN_MODE.empty()) {
+        return true;
+    }
+
+    for (const auto& _prbs : prbs_table) {
+        if (TX_PATTERN_MODE == _prbs.name) {
+            pattern_mode = PATTERN_PRBS;
+            prbs_n       = _prbs.n;
+            prbs_m       = _prbs.m;
+            prbs_state   = (1U << prbs_n) - 1; // all ones seed
+        }
+    }
+
+    if (TX_PATTERN_MODE == "ramp") {
+        pattern_mode = PATTERN_RAMP;
+        ramp_value   = 0;
+    }
+    else if (TX_PATTERN_MODE == "const") {
+        pattern_mode = PATTERN_CONST;
+    }
+    else if (TX_PATTERN_MODE == "tone") {
+        pattern_mode = PATTERN_TONE;
+        nco_phase    = 0;
+        nco_step     = (uint32_t)std::llround(std::fmod(TX_PATTERN_TONE, 1.0) * 4294967296.0);
+
+        auto _level{std::min(TX_PATTERN_LEVEL, SAMPLE_MASK >> 1)};
+
+        for (size_t i{0}; i < (1U << NCO_BITS); ++i) {
+            nco_table[i] = (int16_t)std::lround(_level * std::cos(2.0 * std::numbers::pi * (double)i / (1U << NCO_BITS)));
+        }
+    }
+
+    if (pattern_mode == PATTERN_OFF) {
+        LOG_FORMAT(error, "Unknown TX pattern \"%s\" (%s)", TX_PATTERN_MODE.c_str(), __func__);
+        return false;
+    }
+
+    LOG_FORMAT(info, "TX pattern \"%s\" enabled (%s)", TX_PATTERN_MODE.c_str(), __func__);
+    return true;
+}
+
+bool tx_pattern_is_enabled() {
+    return pattern_mode != PATTERN_OFF;
+}
+
+bool tx_pattern_fill(g_array_t* array) {
+    auto  _words{array->size()};
+    auto* _dst{array->data()};
+
+    switch (pattern_mode) {
+        case PATTERN_PRBS:
+            __fill_prbs(_dst, _words);
+            break;
+        case PATTERN_RAMP:
+            __fill_ramp(_dst, _words);
+            break;
+        case PATTERN_CONST:
+            __fill_const(_dst, _words);
+            break;
+        case PATTERN_TONE:
+            __fill_tone(_dst, _words & ~1UL);
+            break;
+        default:
+            return false;
+    }
+
+    return array->used(pattern_mode == PATTERN_TONE ? _words & ~1UL : _words);
+}
+
+// SECTION: RX checker
+
+#define CHECK_TAIL_WORDS 3 // PRBS history: 3 * 12 bits cover the x^31 tap
+
+typedef enum {
+    CHECK_OFF,
+    CHECK_PRBS,
+    CHECK_RAMP,
+    CHECK_COUNTER
+
+} check_mode_t;
+
+// NOTE: a tap delay split in whole samples and bits, 32-bit lanes suffice
+typedef struct check_lag {
+    uint32_t words;
+    uint32_t bits;
+} check_lag_t;
+
+static check_mode_t          check_mode{CHECK_OFF};
+static check_lag_t           check_n;
+static check_lag_t           check_m;
+static uint32_t              check_mask;
+static uint16_t              check_step;
+static bool                  check_primed;
+static uint16_t              check_tail[CHECK_TAIL_WORDS];
+static std::vector<uint16_t> check_work;
+static rx_check_stats_t      check_stats;
+
+// Self-synchronizing check: the block expected at p[0] is predicted from the
+// received history (s[t] = s[t-m] ^ s[t-n]), so the checker locks after the
+// first 'n' bits and never needs the TX seed. A channel bit error is seen up
+// to three times (at t, t+m and t+n).
+static inline uint32_t __prbs_delay(const uint16_t* p, check_lag_t lag) {
+    uint32_t _hi{p[-(int)lag.words - 1] & SAMPLE_MASK};
+    uint32_t _lo{p[-(int)lag.words - 0] & SAMPLE_MASK};
+
+    return ((_lo >> lag.bits) | (_hi << (SAMPLE_BITS - lag.bits))) & SAMPLE_MASK;
+}
+
+static inline uint32_t __prbs_error(const uint16_t* p) {
+    return ((p[0] & SAMPLE_MASK) ^ __prbs_delay(p, check_m) ^ __prbs_delay(p, check_n));
+}
+
+static inline uint32_t __step_error(const uint16_t* p, uint32_t steps = 1) {
+    return (uint32_t)(uint16_t)(p[0] - p[-(int)steps] - steps * check_step) & check_mask;
+}
+
+// NOTE: branch-free reductions, vectorized by the compiler (no loop-carried
+// dependency but the OR): the per-word analysis runs on errored arrays only
+static uint32_t __scan_prbs(const uint16_t* src, size_t first, size_t words) {
+    uint32_t _acc{0};
+
+    for (size_t i{first}; i < words; ++i) {
+        _acc |= __prbs_error(src + i);
+    }
+    return _acc;
+}
+
+static uint32_t __scan_step(const uint16_t* src, size_t first, size_t words) {
+    uint32_t _acc{0};
+
+    for (size_t i{first}; i < words; ++i) {
+        _acc |= __step_error(src + i);
+    }
+    return _acc;
+}
+
+// NOTE: 'src' is preceded by the tail of the previous array, an error run
+// starting on the first word is a discontinuity between arrays (lost packet)
+static void __analyze_prbs(const uint16_t* src, size_t first, size_t words) {
+    size_t   _run_len{0};
+    size_t   _run_pos{0};
+    uint64_t _run_bits{0};
+
+    auto __close_run = [&]() {
+        if (_run_len == 0) {
+            return;
+        }
+
+        // NOTE: a channel bit error accounts for three error bits at most
+        if (_run_bits > 3 && _run_pos == CHECK_TAIL_WORDS) {
+            check_stats.gaps++;
+        }
+        else if (_run_bits > 3) {
+            check_stats.slips++;
+        }
+        else {
+            check_stats.word_errors += _run_len;
+            check_stats.bit_errors += (unsigned long)_run_bits;
+        }
+        _run_len  = 0;
+        _run_bits = 0;
+    };
+
+    for (size_t i{first}; i < words; ++i) {
+        auto _error{__prbs_error(src + i)};
+
+        if (_error == 0) {
+            __close_run();
+            continue;
+        }
+
+        if (_run_len++ == 0) {
+            _run_pos = i;
+        }
+
+        _run_bits += (uint64_t)std::popcount(_error);
+    }
+    __close_run();
+}
+
+static void __analyze_step(const uint16_t* src, size_t first, size_t words) {
+    for (size_t i{first}; i < words; ++i) {
+        auto _error{__step_error(src + i)};
+
+        if (_error == 0) {
+            continue;
+        }
+
+        // NOTE: one corrupted word breaks two steps, the next one still lands on the sequence
+        if (i + 1 < words && __step_error(src + i + 1, 2) == 0) {
+            auto _expected{(uint16_t)(src[i - 1] + check_step)};
+
+            check_stats.word_errors++;
+            check_stats.bit_errors += (unsigned long)std::popcount((uint32_t)(uint16_t)(src[i] ^ _expected) & check_mask);
+            ++i;
+        }
+        else if (i == CHECK_TAIL_WORDS) {
+            check_stats.gaps++;
+
+            DO_BLOCK_IF(check_step != 0, check_stats.lost_words += _error / check_step);
+        }
+        else {
+            check_stats.slips++;
+        }
+    }
+}
+
+bool rx_check_init() {
+    check_mode   = CHECK_OFF;
+    check_primed = false;
+    check_stats  = {};
+
+    if (RX_CHECK_MODE.empty()) {
+        return true;
+    }
+
+    for (const auto& _prbs : prbs_table) {
+        if (RX_CHECK_MODE == _prbs.name) {
+            check_mode = CHECK_PRBS;
+            check_n    = {_prbs.n / SAMPLE_BITS, _prbs.n % SAMPLE_BITS};
+            check_m    = {_prbs.m / SAMPLE_BITS, _prbs.m % SAMPLE_BITS};
+        }
+    }
+
+    check_step = (uint16_t)RX_CHECK_VALUE;
+
+    if (RX_CHECK_MODE == "ramp") {
+        check_mode = CHECK_RAMP;
+        check_mask = SAMPLE_MASK;
+    }
+    else if (RX_CHECK_MODE == "counter") {
+        check_mode = CHECK_COUNTER;
+        check_mask = 0xFFFF;
+    }
+
+    if (check_mode == CHECK_OFF) {
+        LOG_FORMAT(error, "Unknown RX checker \"%s\" (%s)", RX_CHECK_MODE.c_str(), __func__);
+        return false;
+    }
+
+    LOG_FORMAT(info, "RX checker \"%s\" enabled (%s)", RX_CHECK_MODE.c_str(), __func__);
+    return true;
+}
+
+bool rx_check_is_enabled() {
+    return check_mode != CHECK_OFF;
+}
+
+void rx_check_array(const g_array_t* array) {
+    auto        _words{array->used()};
+    const auto* _src{array->data()};
+
+    if (check_mode == CHECK_OFF || _words < 2 * CHECK_TAIL_WORDS) {
+        return;
+    }
+
+    // NOTE: the array edge is checked on a copy joined to the previous tail
+    uint16_t _edge[3 * CHECK_TAIL_WORDS];
+
+    std::copy_n(check_tail, CHECK_TAIL_WORDS, _edge);
+    std::copy_n(_src, 2 * CHECK_TAIL_WORDS, _edge + CHECK_TAIL_WORDS);
+
+    size_t _first{CHECK_TAIL_WORDS};
+
+    if (!check_primed) {
+        _first += (check_mode == CHECK_PRBS) ? CHECK_TAIL_WORDS : 1;
+    }
+
+    auto _error{(check_mode == CHECK_PRBS) ? __scan_prbs(_edge, _first, 2 * CHECK_TAIL_WORDS) | __scan_prbs(_src, CHECK_TAIL_WORDS, _words)
+                                           : __scan_step(_edge, _first, 2 * CHECK_TAIL_WORDS) | __scan_step(_src, CHECK_TAIL_WORDS, _words)};
+
+    // NOTE: slow path, the whole array is joined to the tail for the analysis
+    if (_error != 0) {
+        check_work.resize(CHECK_TAIL_WORDS + _words);
+
+        std::copy_n(check_tail, CHECK_TAIL_WORDS, check_work.data());
+        std::copy_n(_src, _words, check_work.data() + CHECK_TAIL_WORDS);
+
+        if (check_mode == CHECK_PRBS) {
+            __analyze_prbs(check_work.data(), _first, check_work.size());
+        }
+        else {
+            __analyze_step(check_work.data(), _first, check_work.size());
+        }
+    }
+
+    std::copy_n(_src + _words - CHECK_TAIL_WORDS, CHECK_TAIL_WORDS, check_tail);
+
+    check_primed = true;
+    check_stats.arrays++;
+    check_stats.words += _words;
+}
+
+const rx_check_stats_t& rx_check_get_stats() {
+    return check_stats;
+}
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      patterns.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PATTERNS_HPP
+#define PATTERNS_HPP
+
+#include "globals.hpp"
+
+// NOTE: words are AD9361 samples (12-bit, sign extended) interleaved as I, Q
+
+bool tx_pattern_init();
+
+bool tx_pattern_is_enabled();
+
+bool tx_pattern_fill(g_array_t* array);
+
+typedef struct rx_check_stats {
+    unsigned long arrays;
+    unsigned long words;
+    unsigned long bit_errors;
+    unsigned long word_errors;
+    unsigned long slips;      // sequence jumps inside an array
+    unsigned long gaps;       // discontinuities between arrays (lost packets)
+    unsigned long lost_words; // counter/ramp only, modulo the sequence period
+} rx_check_stats_t;
+
+bool rx_check_init();
+
+bool rx_check_is_enabled();
+
+void rx_check_array(const g_array_t* array);
+
+const rx_check_stats_t& rx_check_get_stats();
+
+#endif // PATTERNS_HPP
@@ -9,8 +9,9 @@
 
 #include "streams.hpp"
 
-#include <filesystem> // path
-#include <fstream>    // ifstream, ofstream
+#include "patterns.hpp"
+
+#include <vector>  // vector
 
 struct decoder_args_t {
     g_array_t*      array  = nullptr;
@@ -18,8 +19,12 @@ struct decoder_args_t {
     g_udp_server_t* server = nullptr;
 };
 
-GDecoder* stream_decoder{nullptr};
-GEncoder* stream_encoder{nullptr};
+GDecoder*  stream_decoder{nullptr};
+GEncoder*  stream_encoder{nullptr};
+GCodec*    stream_codec{nullptr};
+GPlayer*   stream_player{nullptr};
+GCapture*  stream_capture{nullptr};
+GRecorder* stream_recorder{nullptr};
 
 static bool decode_short_msg(std::any data, std::any args) {
     auto* _packet = std::any_cast<packet_t*>(data);
@@ -76,6 +81,19 @@ static bool decode_large_msg(std::any data, std::any args) {
     if (_packet_type == TX_STREAM_TYPE) {
         auto* src_data = _message->data();
         auto  src_used = _message->used();
+
+        // NOTE: the codec is signalled in the 'spare_0' header byte
+        if (_message->head()->spare_0 == GCodec::DELTA_PACK) {
+            static GCodec _codec(_array->size());
+
+            return _array->used(_codec.Decode(src_data, src_used, _array->data(), _array->size())) && (_array->used() > 0);
+        }
+
+        if (_message->head()->spare_0 != GCodec::RAW) {
+            LOG_FORMAT(error, "Invalid codec: %d (%s)", _message->head()->spare_0, __func__);
+            return false;
+        }
+
         memcpy(_array->data_bytes(), src_data, src_used);
 
         auto words_num = src_used / FIFO_WORD_SIZE;
@@ -89,6 +107,12 @@ static bool decode_large_msg(std::any data, std::any args) {
 }
 
 bool stream_reader_for_tx_words(g_array_t* array, g_udp_client_t* client, g_udp_server_t* server) {
+    // SECTION: PATTERN generator
+
+    if (tx_pattern_is_enabled()) {
+        return tx_pattern_fill(array);
+    }
+
     // SECTION: UDP streaming
 
     if (TX_FILE_NAME.empty()) {
@@ -116,25 +140,40 @@ bool stream_reader_for_tx_words(g_array_t* array, g_udp_client_t* client, g_udp_
 
     // SECTION: FILE streaming
 
-    std::ifstream ifs;
-    ifs.open(TX_FILE_NAME, std::ios::binary);
+    auto _words{0UL};
 
-    if (ifs.is_open()) {
-        ifs.seekg(0, std::ifstream::end);
-        auto bytes{ifs.tellg()};
-        ifs.seekg(0, std::ifstream::beg);
+    if (TX_FILE_MODE == "capture") {
+        // NOTE: TX_FILE_NAME is the RX_FILE_NAME of the capture
+        if (stream_capture == nullptr) {
+            stream_capture = new GCapture(TX_FILE_NAME);
+        }
 
-        auto words{array->size()};
-        words = bytes > 0 ? std::min(words, (size_t)bytes / FIFO_WORD_SIZE) : 0;
-        array->used(words);
+        if (!stream_capture->Open()) {
+            return false;
+        }
 
-        auto* __s{array->data_bytes()};
-        auto  __n{array->used_bytes()};
-        ifs.read((char*)__s, (std::streamsize)__n);
-        ifs.close();
-        return true;
+        _words = stream_capture->Replay(array->data_bytes(), array->size_bytes(), TX_FILE_SPEED, TX_FILE_LOOP) / FIFO_WORD_SIZE;
     }
-    return false;
+    else {
+        if (stream_player == nullptr) {
+            stream_player = new GPlayer(TX_FILE_NAME, FIFO_WORD_SIZE, TX_FILE_LOOP, TX_FILE_RATE);
+        }
+
+        if (!stream_player->Open()) {
+            return false;
+        }
+
+        _words = stream_player->Read(array->data(), array->size());
+    }
+
+    array->used(_words);
+
+    // NOTE: the whole file was played once, the deamon stops like on QUIT_DEAMON
+    if (_words == 0) {
+        Global::quit_deamon();
+        LOG_FORMAT(info, "End of \"%s\" reached (%s)", TX_FILE_NAME.c_str(), __func__);
+    }
+    return true;
 }
 
 bool stream_writer_for_rx_words(g_array_t* array, g_udp_client_t* client, g_udp_server_t* server) {
@@ -145,10 +184,28 @@ bool stream_writer_for_rx_words(g_array_t* array, g_udp_client_t* client, g_udp_
             stream_encoder = new GEncoder(RX_STREAM_ID);
         }
 
-        auto _line  = 0;
-        auto _error = false;
+        auto  _line  = 0;
+        auto  _error = false;
+        auto* _data  = array->data_bytes();
+        auto  _bytes = array->used_bytes();
+
+        // SECTION: CODEC stage (RAW when the array does not shrink)
+
+        if (RX_STREAM_CODEC == GCodec::DELTA_PACK) {
+            static std::vector<uint8_t> _coded(GCodec::MaxEncodedBytes(array->size()));
+
+            if (stream_codec == nullptr) {
+                stream_codec = new GCodec(array->size());
+            }
+
+            auto _coded_bytes{stream_codec->Encode(array->data(), array->used(), _coded.data(), _coded.size())};
+
+            stream_encoder->SetCodec(_coded_bytes > 0 ? GCodec::DELTA_PACK : GCodec::RAW);
 
-        if (stream_encoder->Process(RX_STREAM_TYPE, array->data_bytes(), array->used_bytes())) {
+            DO_BLOCK_IF(_coded_bytes > 0, _data = _coded.data(); _bytes = _coded_bytes);
+        }
+
+        if (stream_encoder->Process(RX_STREAM_TYPE, _data, (uint32_t)_bytes)) {
             packet_t packet;
 
             while (!stream_encoder->IsEmpty() && !_error) {
@@ -169,27 +226,17 @@ _exit_label:
 
     // SECTION: FILE streaming
 
-    static auto _index{0U};
-    static auto _path{std::filesystem::path(RX_FILE_NAME)};
-
-    char _tail[32];
-    snprintf(_tail, sizeof(_tail), "_%06u%s", _index++, _path.extension().c_str());
-
-    auto _name{_path.parent_path()};
-    _name /= _path.stem();
-    _name += _tail;
+    if (stream_recorder == nullptr) {
+        stream_recorder = new GRecorder(RX_FILE_NAME, array->size_bytes(), RX_ROLLER_NUMBER, (uint64_t)RX_FILE_SEGMENT << 20);
 
-    std::ofstream ofs;
-    ofs.open(_name, std::ios::binary);
-
-    if (ofs.is_open()) {
-        auto* __s{array->data_bytes()};
-        auto  __n{array->used_bytes()};
-        ofs.write((char*)__s, (std::streamsize)__n);
-        ofs.close();
-        return true;
+        if (!stream_recorder->Start()) {
+            return false;
+        }
     }
-    return false;
+
+    // NOTE: a full staging ring drops the array (counted), the waiter never blocks
+    stream_recorder->Push(array->data_bytes(), array->used_bytes());
+    return true;
 }
 
 // packet_type
@@ -10,12 +10,20 @@
 #ifndef STREAMS_HPP
 #define STREAMS_HPP
 
+#include "GCapture.hpp"
+#include "GCodec.hpp"
 #include "GDecoder.hpp"
 #include "GEncoder.hpp"
+#include "GPlayer.hpp"
+#include "GRecorder.hpp"
 #include "globals.hpp"
 
-extern GDecoder* stream_decoder;
-extern GEncoder* stream_encoder;
+extern GDecoder*  stream_decoder;
+extern GEncoder*  stream_encoder;
+extern GCodec*    stream_codec;
+extern GPlayer*   stream_player;
+extern GCapture*  stream_capture;
+extern GRecorder* stream_recorder;
 
 bool stream_reader_for_tx_words(g_array_t* array, g_udp_client_t* client, g_udp_server_t* server);
 
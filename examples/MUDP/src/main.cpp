@@ -11,6 +11,7 @@
 #include "GFiFo.hpp"
 #include "GLogger.hpp"
 #include "GOptions.hpp"
+#include "GThread.hpp"
 #include "GUdpClient.hpp"
 #include "GUdpServer.hpp"
 #include "f_gm_dh.hpp"
@@ -18,10 +19,8 @@
 #include "f_hssl1.hpp"
 #include "f_hssl2.hpp"
 
-#include <condition_variable> // condition_variable
-#include <filesystem>         // path
-#include <mutex>              // mutex, lock_guard, unique_lock
-#include <thread>             // thread
+#include <filesystem> // path
+#include <thread>     // thread
 
 std::string  GM_MC_SERVER_ADDR   = "127.0.0.1";
 int          GM_MC_SERVER_PORT   = 30001;
@@ -42,6 +41,23 @@ int          HSSL2_CLIENT_PORT   = 60101;
 unsigned int LINK_FIFO_DEPTH     = 40;
 int          LINK_FIFO_MAX_LEVEL = 20;
 int          LINK_FIFO_MIN_LEVEL = 2;
+std::string  GM_MC_SOCKET_SPEC   = "";
+std::string  GM_MC_DECODER_SPEC  = "";
+std::string  GM_DH_SOCKET_SPEC   = "";
+std::string  GM_DH_DECODER_SPEC  = "";
+std::string  HSSL1_SOCKET_SPEC   = "";
+std::string  HSSL1_DECODER_SPEC  = "";
+std::string  HSSL2_SOCKET_SPEC   = "";
+std::string  HSSL2_DECODER_SPEC  = "";
+
+static thread_config_t gm_mc_socket_thread;
+static thread_config_t gm_mc_decoder_thread;
+static thread_config_t gm_dh_socket_thread;
+static thread_config_t gm_dh_decoder_thread;
+static thread_config_t hssl1_socket_thread;
+static thread_config_t hssl1_decoder_thread;
+static thread_config_t hssl2_socket_thread;
+static thread_config_t hssl2_decoder_thread;
 
 static void load_options(const char* filename) {
     auto opts = GOptions();
@@ -66,6 +82,14 @@ static void load_options(const char* filename) {
     opts.Insert<unsigned int>("fifo.LINK_FIFO_DEPTH"    , LINK_FIFO_DEPTH    );
     opts.Insert<int         >("fifo.LINK_FIFO_MAX_LEVEL", LINK_FIFO_MAX_LEVEL);
     opts.Insert<int         >("fifo.LINK_FIFO_MIN_LEVEL", LINK_FIFO_MIN_LEVEL);
+    opts.Insert<std::string >("thread.GM_MC_SOCKET_SPEC" , GM_MC_SOCKET_SPEC  );
+    opts.Insert<std::string >("thread.GM_MC_DECODER_SPEC", GM_MC_DECODER_SPEC );
+    opts.Insert<std::string >("thread.GM_DH_SOCKET_SPEC" , GM_DH_SOCKET_SPEC  );
+    opts.Insert<std::string >("thread.GM_DH_DECODER_SPEC", GM_DH_DECODER_SPEC );
+    opts.Insert<std::string >("thread.HSSL1_SOCKET_SPEC" , HSSL1_SOCKET_SPEC  );
+    opts.Insert<std::string >("thread.HSSL1_DECODER_SPEC", HSSL1_DECODER_SPEC );
+    opts.Insert<std::string >("thread.HSSL2_SOCKET_SPEC" , HSSL2_SOCKET_SPEC  );
+    opts.Insert<std::string >("thread.HSSL2_DECODER_SPEC", HSSL2_DECODER_SPEC );
     // clang-format on
 
     if (opts.Read(filename)) {
@@ -89,15 +113,29 @@ static void load_options(const char* filename) {
         LINK_FIFO_DEPTH     = opts.Get<unsigned int>("fifo.LINK_FIFO_DEPTH"    );
         LINK_FIFO_MAX_LEVEL = opts.Get<int         >("fifo.LINK_FIFO_MAX_LEVEL");
         LINK_FIFO_MIN_LEVEL = opts.Get<int         >("fifo.LINK_FIFO_MIN_LEVEL");
+        GM_MC_SOCKET_SPEC   = opts.Get<std::string >("thread.GM_MC_SOCKET_SPEC" );
+        GM_MC_DECODER_SPEC  = opts.Get<std::string >("thread.GM_MC_DECODER_SPEC");
+        GM_DH_SOCKET_SPEC   = opts.Get<std::string >("thread.GM_DH_SOCKET_SPEC" );
+        GM_DH_DECODER_SPEC  = opts.Get<std::string >("thread.GM_DH_DECODER_SPEC");
+        HSSL1_SOCKET_SPEC   = opts.Get<std::string >("thread.HSSL1_SOCKET_SPEC" );
+        HSSL1_DECODER_SPEC  = opts.Get<std::string >("thread.HSSL1_DECODER_SPEC");
+        HSSL2_SOCKET_SPEC   = opts.Get<std::string >("thread.HSSL2_SOCKET_SPEC" );
+        HSSL2_DECODER_SPEC  = opts.Get<std::string >("thread.HSSL2_DECODER_SPEC");
         // clang-format on
     }
 }
 
+static void configure_thread(const char* name, thread_config_t config) {
+    config.name = name;
+    GThread::Configure(config);
+}
+
 static void send_signal_start_flow(GFiFo* fifo, GUdpClient* client) {
     GFiFo::fsm_levels_t new_level;
     GFiFo::fsm_levels_t old_level;
 
-    if (fifo->IsLevelChanged(&new_level, &old_level)) {
+    // NOTE: the MIN_LEVEL_PASSED crossed by the decoder pops
+    if (fifo->IsLevelChanged(GFiFo::CONSUMER_SIDE, &new_level, &old_level)) {
         if (new_level == GFiFo::MIN_LEVEL_PASSED) {
             packet_head_t packet;
             packet.packet_type     = packet_type_t::signal_start_flow;
@@ -115,7 +153,8 @@ static void send_signal_stop_flow(GFiFo* fifo, GUdpClient* client) {
     GFiFo::fsm_levels_t new_level;
     GFiFo::fsm_levels_t old_level;
 
-    if (fifo->IsLevelChanged(&new_level, &old_level)) {
+    // NOTE: the MAX_LEVEL_PASSED crossed by the socket pushes
+    if (fifo->IsLevelChanged(GFiFo::PRODUCER_SIDE, &new_level, &old_level)) {
         if (new_level == GFiFo::MAX_LEVEL_PASSED) {
             packet_head_t packet;
             packet.packet_type     = packet_type_t::signal_stop_flow;
@@ -138,11 +177,9 @@ static void log_server_statistics(const GDecoder* decoder, const char* func) {
 static void f_gm_mc_server(bool& quit, GUdpServer& server, GUdpClient& client) {
     LOG_FORMAT(trace, "Thread STARTED (%s)", __func__);
 
-    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
+    configure_thread("gm_mc_socket", gm_mc_socket_thread);
 
-    auto                    _total{0};
-    std::mutex              _mutex;
-    std::condition_variable _event;
+    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
 
     // SECTION: decoder thread
 
@@ -153,16 +190,13 @@ static void f_gm_mc_server(bool& quit, GUdpServer& server, GUdpClient& client) {
     auto decoder{GDecoder(f_gm_mc::decode_packet, f_gm_mc::decode_message, args)};
 
     std::thread t_decoder([&] {
-        while (!quit) {
-            std::unique_lock _guard(_mutex);
-            _event.wait(_guard, [&_total] { return _total > 0; });
+        configure_thread("gm_mc_decoder", gm_mc_decoder_thread);
 
-            auto _new_data{fifo.Pop(decoder.packet_ptr(), decoder.packet_len()) > 0};
+        while (!quit) {
+            // NOTE: parked while the link FIFO is empty, released by a push or a close
+            auto _new_data{fifo.PopWait(decoder.packet_ptr(), decoder.packet_len()) > 0};
             send_signal_start_flow(&fifo, &client);
 
-            _total--;
-            _guard.unlock();
-
             if (_new_data) {
                 decoder.Process();
             }
@@ -178,23 +212,16 @@ static void f_gm_mc_server(bool& quit, GUdpServer& server, GUdpClient& client) {
     while (!quit) {
         if (server.Receive(buffer, &bytes)) {
             if (GPacket::IsValid(buffer, bytes)) {
-                std::lock_guard _guard(_mutex);
-
-                auto _new_data{fifo.Push(buffer, bytes)};
+                // NOTE: never blocks the socket, the datagram is dropped if the link FIFO is full
+                fifo.Push(buffer, bytes);
                 send_signal_stop_flow(&fifo, &client);
-
-                if (_new_data) {
-                    _total++;
-                    _event.notify_one();
-                }
             }
             else {
                 LOG_FORMAT(error, "Wrong packet format (%s)", __func__);
             }
         }
     }
-    _total = 1;
-    _event.notify_one();
+    fifo.Close();
     t_decoder.join();
 
     log_server_statistics(&decoder, __func__);
@@ -204,11 +231,9 @@ static void f_gm_mc_server(bool& quit, GUdpServer& server, GUdpClient& client) {
 static void f_gm_dh_server(const bool& quit, GUdpServer& server, GUdpClient& client) {
     LOG_FORMAT(trace, "Thread STARTED (%s)", __func__);
 
-    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
+    configure_thread("gm_dh_socket", gm_dh_socket_thread);
 
-    auto                    _total{0};
-    std::mutex              _mutex;
-    std::condition_variable _event;
+    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
 
     // SECTION: decoder thread
 
@@ -218,16 +243,13 @@ static void f_gm_dh_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     auto decoder{GDecoder(f_gm_dh::decode_packet, f_gm_dh::decode_message, args)};
 
     std::thread t_decoder([&] {
-        while (!quit) {
-            std::unique_lock _guard(_mutex);
-            _event.wait(_guard, [&_total] { return _total > 0; });
+        configure_thread("gm_dh_decoder", gm_dh_decoder_thread);
 
-            auto _new_data{fifo.Pop(decoder.packet_ptr(), decoder.packet_len()) > 0};
+        while (!quit) {
+            // NOTE: parked while the link FIFO is empty, released by a push or a close
+            auto _new_data{fifo.PopWait(decoder.packet_ptr(), decoder.packet_len()) > 0};
             send_signal_start_flow(&fifo, &client);
 
-            _total--;
-            _guard.unlock();
-
             if (_new_data) {
                 decoder.Process();
             }
@@ -242,23 +264,16 @@ static void f_gm_dh_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     while (!quit) {
         if (server.Receive(buffer, &bytes)) {
             if (GPacket::IsValid(buffer, bytes)) {
-                std::lock_guard _guard(_mutex);
-
-                auto _new_data{fifo.Push(buffer, bytes)};
+                // NOTE: never blocks the socket, the datagram is dropped if the link FIFO is full
+                fifo.Push(buffer, bytes);
                 send_signal_stop_flow(&fifo, &client);
-
-                if (_new_data) {
-                    _total++;
-                    _event.notify_one();
-                }
             }
             else {
                 LOG_FORMAT(error, "Wrong packet format (%s)", __func__);
             }
         }
     }
-    _total = 1;
-    _event.notify_one();
+    fifo.Close();
     t_decoder.join();
 
     log_server_statistics(&decoder, __func__);
@@ -268,11 +283,9 @@ static void f_gm_dh_server(const bool& quit, GUdpServer& server, GUdpClient& cli
 static void f_hssl1_server(const bool& quit, GUdpServer& server, GUdpClient& client) {
     LOG_FORMAT(trace, "Thread STARTED (%s)", __func__);
 
-    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
+    configure_thread("hssl1_socket", hssl1_socket_thread);
 
-    auto                    _total{0};
-    std::mutex              _mutex;
-    std::condition_variable _event;
+    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
 
     // SECTION: decoder thread
 
@@ -282,16 +295,13 @@ static void f_hssl1_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     auto decoder{GDecoder(f_hssl1::decode_packet, f_hssl1::decode_message, args)};
 
     std::thread t_decoder([&] {
-        while (!quit) {
-            std::unique_lock _guard(_mutex);
-            _event.wait(_guard, [&_total] { return _total > 0; });
+        configure_thread("hssl1_decoder", hssl1_decoder_thread);
 
-            auto _new_data{fifo.Pop(decoder.packet_ptr(), decoder.packet_len()) > 0};
+        while (!quit) {
+            // NOTE: parked while the link FIFO is empty, released by a push or a close
+            auto _new_data{fifo.PopWait(decoder.packet_ptr(), decoder.packet_len()) > 0};
             send_signal_start_flow(&fifo, &client);
 
-            _total--;
-            _guard.unlock();
-
             if (_new_data) {
                 decoder.Process();
             }
@@ -306,23 +316,16 @@ static void f_hssl1_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     while (!quit) {
         if (server.Receive(buffer, &bytes)) {
             if (GPacket::IsValid(buffer, bytes)) {
-                std::lock_guard _guard(_mutex);
-
-                auto _new_data{fifo.Push(buffer, bytes)};
+                // NOTE: never blocks the socket, the datagram is dropped if the link FIFO is full
+                fifo.Push(buffer, bytes);
                 send_signal_stop_flow(&fifo, &client);
-
-                if (_new_data) {
-                    _total++;
-                    _event.notify_one();
-                }
             }
             else {
                 LOG_FORMAT(error, "Wrong packet format (%s)", __func__);
             }
         }
     }
-    _total = 1;
-    _event.notify_one();
+    fifo.Close();
     t_decoder.join();
 
     log_server_statistics(&decoder, __func__);
@@ -332,11 +335,9 @@ static void f_hssl1_server(const bool& quit, GUdpServer& server, GUdpClient& cli
 static void f_hssl2_server(const bool& quit, GUdpServer& server, GUdpClient& client) {
     LOG_FORMAT(trace, "Thread STARTED (%s)", __func__);
 
-    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
+    configure_thread("hssl2_socket", hssl2_socket_thread);
 
-    auto                    _total{0};
-    std::mutex              _mutex;
-    std::condition_variable _event;
+    auto fifo{GFiFo(GPacket::PACKET_FULL_SIZE, LINK_FIFO_DEPTH, LINK_FIFO_MAX_LEVEL, LINK_FIFO_MIN_LEVEL)};
 
     // SECTION: decoder thread
 
@@ -346,16 +347,13 @@ static void f_hssl2_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     auto decoder{GDecoder(f_hssl2::decode_packet, f_hssl2::decode_message, args)};
 
     std::thread t_decoder([&] {
-        while (!quit) {
-            std::unique_lock _guard(_mutex);
-            _event.wait(_guard, [&_total] { return _total > 0; });
+        configure_thread("hssl2_decoder", hssl2_decoder_thread);
 
-            auto _new_data{fifo.Pop(decoder.packet_ptr(), decoder.packet_len()) > 0};
+        while (!quit) {
+            // NOTE: parked while the link FIFO is empty, released by a push or a close
+            auto _new_data{fifo.PopWait(decoder.packet_ptr(), decoder.packet_len()) > 0};
             send_signal_start_flow(&fifo, &client);
 
-            _total--;
-            _guard.unlock();
-
             if (_new_data) {
                 decoder.Process();
             }
@@ -370,23 +368,16 @@ static void f_hssl2_server(const bool& quit, GUdpServer& server, GUdpClient& cli
     while (!quit) {
         if (server.Receive(buffer, &bytes)) {
             if (GPacket::IsValid(buffer, bytes)) {
-                std::lock_guard _guard(_mutex);
-
-                auto _new_data{fifo.Push(buffer, bytes)};
+                // NOTE: never blocks the socket, the datagram is dropped if the link FIFO is full
+                fifo.Push(buffer, bytes);
                 send_signal_stop_flow(&fifo, &client);
-
-                if (_new_data) {
-                    _total++;
-                    _event.notify_one();
-                }
             }
             else {
                 LOG_FORMAT(error, "Wrong packet format (%s)", __func__);
             }
         }
     }
-    _total = 1;
-    _event.notify_one();
+    fifo.Close();
     t_decoder.join();
 
     log_server_statistics(&decoder, __func__);
@@ -403,6 +394,25 @@ int main(int argc, char* argv[]) {
 
     load_options(exec_cfg.c_str());
 
+    // clang-format off
+    auto _parsed{GThread::Parse(GM_MC_SOCKET_SPEC , &gm_mc_socket_thread ) &&
+                 GThread::Parse(GM_MC_DECODER_SPEC, &gm_mc_decoder_thread) &&
+                 GThread::Parse(GM_DH_SOCKET_SPEC , &gm_dh_socket_thread ) &&
+                 GThread::Parse(GM_DH_DECODER_SPEC, &gm_dh_decoder_thread) &&
+                 GThread::Parse(HSSL1_SOCKET_SPEC , &hssl1_socket_thread ) &&
+                 GThread::Parse(HSSL1_DECODER_SPEC, &hssl1_decoder_thread) &&
+                 GThread::Parse(HSSL2_SOCKET_SPEC , &hssl2_socket_thread ) &&
+                 GThread::Parse(HSSL2_DECODER_SPEC, &hssl2_decoder_thread)};
+    // clang-format on
+
+    if (!_parsed) {
+        LOG_FORMAT(trace, "Process STOPPED (%s)", exec.stem().c_str());
+        return 1;
+    }
+
+    GThread::CheckPrivileges({gm_mc_socket_thread, gm_mc_decoder_thread, gm_dh_socket_thread, gm_dh_decoder_thread, //
+                              hssl1_socket_thread, hssl1_decoder_thread, hssl2_socket_thread, hssl2_decoder_thread});
+
     auto gm_mc_server = GUdpServer(GM_MC_SERVER_ADDR.c_str(), GM_MC_SERVER_PORT, "GM-MC");
     auto gm_mc_client = GUdpClient(GM_MC_CLIENT_ADDR.c_str(), GM_MC_CLIENT_PORT, "GM-MC");
     auto gm_dh_server = GUdpServer(GM_DH_SERVER_ADDR.c_str(), GM_DH_SERVER_PORT, "GM-DH");
@@ -11,7 +11,9 @@
 #include "definitions.hpp"
 #include "sdr_if.hpp"
 #include "spi_if.hpp"
+#include "spi_sim.hpp"
 
+#include <cstring>    // strcmp
 #include <filesystem> // path
 
 int main(int argc, char* argv[]) {
@@ -21,10 +23,27 @@ int main(int argc, char* argv[]) {
     GLogger::Initialize(exec_log.c_str());
     LOG_FORMAT(trace, "Process STARTED (%s)", exec.stem().c_str());
 
-    if (SPI_SDR_Init(SPI_SDR1_CS, true, false)) {
+    // NOTE: '--sim' runs the driver against the register-level AD9361 model
+    auto _sim{argc > 1 && strcmp(argv[1], "--sim") == 0};
+
+    if (_sim ? SPI_SDR_InitSim(SPI_SDR1_CS) : SPI_SDR_Init(SPI_SDR1_CS, true, false)) {
         SDR_Configure(SPI_SDR1_CS);
     }
 
+    if (_sim) {
+        SIM_Report("SDR_Configure");
+
+        // NOTE: capture, diff and apply round trip of a 100 MHz RX LO retune
+        SDR_Profile_Test(SPI_SDR1_CS, 100000000UL);
+        SIM_Report("SDR_Profile_Test");
+
+        // NOTE: telemetry sampling while switching, no transaction may interleave
+        SDR_Bus_Test(SPI_SDR1_CS, 100000000UL, 25);
+        SIM_Report("SDR_Bus_Test");
+
+        SIM_Exit();
+    }
+
     LOG_FORMAT(trace, "Process STOPPED (%s)", exec.stem().c_str());
     return 0;
 }
@@ -13,6 +13,7 @@
 #include "GArray.hpp"  // GArray
 #include "GDefine.hpp" // DO_IF, GOTO_IF
 #include "GLogger.hpp" // LOG_FORMAT, debug
+#include "GMemory.hpp" // GMemory
 
 #include <algorithm> // min
 #include <mutex>     // lock_guard, mutex
@@ -72,6 +73,17 @@ template <typename T> class GArrayRoller {
 
     GArrayRoller& operator=(const GArrayRoller& array_roller) = delete;
 
+    // NOTE: every array page is written once, no first-touch fault is left to the streaming
+    void Prefault() {
+        std::lock_guard<std::mutex> _lock(m_mutex);
+
+        if (m_arrays != nullptr) {
+            for (decltype(m_number) i{0}; i < m_number; ++i) {
+                GMemory::Prefault(m_arrays[i]->data(), m_arrays[i]->size_bytes());
+            }
+        }
+    }
+
     void Reset() {
         std::lock_guard<std::mutex> _lock(m_mutex);
 
@@ -10,37 +10,138 @@
 #ifndef GBARRIER_HPP
 #define GBARRIER_HPP
 
-#include <condition_variable> // condition_variable
-#include <mutex>              // defer_lock, mutex, unique_lock
+#include "GWait.hpp" // GWait, wait_strategy_t
+
+#include <atomic>  // atomic
+#include <chrono>  // nanoseconds, steady_clock
+#include <cstdint> // uint32_t
+
+// Gate and barrier on futex words, for any number of threads:
+//
+// gate    : Open releases all the threads in Wait, until the next Close
+// barrier : the generation ends when all the participants have arrived, then
+//           the threads waiting on it are released at once
+//
+// The release side never enters the kernel when nobody is parked, and a
+// thread finding the word already changed returns without a syscall.
 
 class GBarrier {
   public:
+    static constexpr std::chrono::nanoseconds NEVER{std::chrono::nanoseconds::max()};
+
+    GBarrier(unsigned participants = 1, const wait_strategy_t& strategy = {}) {
+        m_participants = participants > 0 ? participants : 1;
+        m_wait         = strategy;
+    }
+
+    GBarrier(const GBarrier& barrier) = delete;
+
+    GBarrier& operator=(const GBarrier& barrier) = delete;
+
+    // SECTION: gate
+
     void Close() {
-        std::unique_lock _gate(m_mutex, std::defer_lock);
-        _gate.lock();
-        m_is_open = false;
-        _gate.unlock();
+        m_is_open.store(0, std::memory_order_release);
     }
 
     void Open() {
-        std::unique_lock _gate(m_mutex, std::defer_lock);
-        _gate.lock();
-        m_is_open = true;
-        _gate.unlock();
-        m_event.notify_one();
+        m_is_open.store(1, std::memory_order_seq_cst);
+        Release(m_is_open);
     }
 
-    void Wait() {
-        std::unique_lock _gate(m_mutex, std::defer_lock);
-        _gate.lock();
-        m_event.wait(_gate, [&] { return m_is_open; });
-        _gate.unlock();
+    // NOTE: returns false on timeout
+    bool Wait(std::chrono::nanoseconds timeout = NEVER) {
+        return Block(m_is_open, 0, timeout);
+    }
+
+    // SECTION: barrier
+
+    // NOTE: one arrival per participant and generation, returns the generation to await
+    uint32_t Arrive() {
+        auto _generation{m_generation.load(std::memory_order_acquire)};
+
+        if (m_arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == m_participants) {
+            // NOTE: a subtraction, an early arrival of the next generation is kept
+            m_arrived.fetch_sub(m_participants, std::memory_order_relaxed);
+            m_generation.fetch_add(1, std::memory_order_seq_cst);
+            Release(m_generation);
+        }
+        return _generation;
+    }
+
+    // NOTE: returns false on timeout, the arrival is not withdrawn
+    bool Await(uint32_t generation, std::chrono::nanoseconds timeout = NEVER) {
+        return Block(m_generation, generation, timeout);
+    }
+
+    bool ArriveAndWait(std::chrono::nanoseconds timeout = NEVER) {
+        return Await(Arrive(), timeout);
+    }
+
+    [[nodiscard]] auto generation() const {
+        return m_generation.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto participants() const {
+        return m_participants;
     }
 
   private:
-    std::condition_variable m_event;
-    std::mutex              m_mutex;
-    bool                    m_is_open{false};
+    bool Block(const std::atomic<uint32_t>& word, uint32_t old, std::chrono::nanoseconds timeout) {
+        // NOTE: fast path, already released
+        if (word.load(std::memory_order_acquire) != old) {
+            return true;
+        }
+
+        const bool _timed{timeout != NEVER};
+        const auto _deadline{_timed ? std::chrono::steady_clock::now() + timeout : std::chrono::steady_clock::time_point::max()};
+
+        if (m_wait.mode != WAIT_BLOCKING) {
+            for (unsigned i{1}; m_wait.mode == WAIT_BUSY_SPIN || i <= m_wait.spins; ++i) {
+                GWait::Relax();
+
+                if (word.load(std::memory_order_acquire) != old) {
+                    return true;
+                }
+
+                // NOTE: the clock is read once every 256 spins
+                if (_timed && (i & 0xFF) == 0 && std::chrono::steady_clock::now() >= _deadline) {
+                    return false;
+                }
+            }
+        }
+
+        // NOTE: the waiters count and the word are both sequentially consistent,
+        // so either the releaser sees the waiter or the waiter sees the release
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+        auto _released{true};
+
+        while (word.load(std::memory_order_seq_cst) == old) {
+            if (!GWait::Park(word, old, _timed ? &_deadline : nullptr)) {
+                _released = word.load(std::memory_order_acquire) != old;
+                break;
+            }
+        }
+
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return _released;
+    }
+
+    void Release(const std::atomic<uint32_t>& word) {
+        // NOTE: no syscall if nobody is parked (a busy spinner never is)
+        if (m_waiters.load(std::memory_order_seq_cst) > 0) {
+            GWait::Wake(word);
+        }
+    }
+
+    unsigned        m_participants{1};
+    wait_strategy_t m_wait;
+
+    std::atomic<uint32_t> m_is_open{0};
+    std::atomic<uint32_t> m_generation{0};
+    std::atomic<unsigned> m_arrived{0};
+    std::atomic<unsigned> m_waiters{0};
 };
 
 #endif // GBARRIER_HPP
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GCapture.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GCapture.hpp"
+
+#include "GLogger.hpp"
+
+#include <algorithm>  // min
+#include <cerrno>     // errno
+#include <cstring>    // memcpy, strerror
+#include <fcntl.h>    // open
+#include <filesystem> // path
+#include <sys/mman.h> // madvise, mmap, munmap
+#include <sys/stat.h> // fstat
+#include <thread>     // sleep_until
+#include <unistd.h>   // close
+
+// NOTE: an empty file is not mapped (nullptr, 0)
+static bool __map(const std::string& name, const uint8_t** data, size_t* size) {
+    auto _fd{open(name.c_str(), O_RDONLY)};
+
+    if (_fd < 0) {
+        LOG_FORMAT(error, "Unable to open \"%s\": %s (%s)", name.c_str(), strerror(errno), __func__);
+        return false;
+    }
+
+    struct stat _st {};
+
+    if (fstat(_fd, &_st) != 0) {
+        LOG_FORMAT(error, "Unable to stat \"%s\": %s (%s)", name.c_str(), strerror(errno), __func__);
+        close(_fd);
+        return false;
+    }
+
+    *data = nullptr;
+    *size = static_cast<size_t>(_st.st_size);
+
+    if (*size > 0) {
+        auto* _map{mmap(nullptr, *size, PROT_READ, MAP_PRIVATE, _fd, 0)};
+
+        if (_map == MAP_FAILED) {
+            LOG_FORMAT(error, "Unable to map \"%s\": %s (%s)", name.c_str(), strerror(errno), __func__);
+            close(_fd);
+            return false;
+        }
+
+        madvise(_map, *size, MADV_SEQUENTIAL);
+        *data = static_cast<const uint8_t*>(_map);
+    }
+
+    close(_fd);
+    return true;
+}
+
+GCapture::GCapture(const std::string& path) {
+    m_path = path;
+}
+
+GCapture::~GCapture() {
+    Close();
+}
+
+bool GCapture::Open() {
+    if (m_header != nullptr) {
+        return true;
+    }
+
+    auto _path{std::filesystem::path(m_path)};
+    auto _name{_path.parent_path() / _path.stem()};
+    auto _idx_name{_name};
+    _idx_name += ".idx";
+
+    const uint8_t* _data{nullptr};
+
+    if (!__map(_idx_name, &_data, &m_index_size)) {
+        return false;
+    }
+
+    m_header = reinterpret_cast<const recorder_header_t*>(_data);
+
+    if (m_index_size < sizeof(recorder_header_t) || m_header->magic != GRecorder::MAGIC || m_header->version != GRecorder::VERSION || m_header->index_bytes != sizeof(recorder_index_t)) {
+        LOG_FORMAT(error, "Invalid capture index \"%s\" (%s)", _idx_name.c_str(), __func__);
+        Close();
+        return false;
+    }
+
+    // NOTE: a trailing partial entry (interrupted capture) is ignored
+    m_index   = reinterpret_cast<const recorder_index_t*>(_data + sizeof(recorder_header_t));
+    m_records = (m_index_size - sizeof(recorder_header_t)) / sizeof(recorder_index_t);
+
+    uint32_t _segments{0};
+
+    for (size_t i{0}; i < m_records; ++i) {
+        _segments = std::max(_segments, m_index[i].segment + 1);
+    }
+
+    for (uint32_t s{0}; s < _segments; ++s) {
+        char _tail[32];
+        snprintf(_tail, sizeof(_tail), "_%06u", s);
+
+        auto _seg_name{_name};
+        _seg_name += _tail;
+        _seg_name += _path.extension();
+
+        const uint8_t* _seg_data{nullptr};
+        size_t         _seg_size{0};
+
+        if (!__map(_seg_name, &_seg_data, &_seg_size)) {
+            Close();
+            return false;
+        }
+
+        m_segments.emplace_back(_seg_data, _seg_size);
+    }
+
+    // NOTE: a property of the capture, each counter gap is counted once here
+    m_lost = 0;
+
+    for (size_t i{0}; i < m_records; ++i) {
+        const auto& _entry{m_index[i]};
+
+        if (_entry.offset + _entry.bytes > m_segments[_entry.segment].second) {
+            LOG_FORMAT(error, "Record %zu is out of segment %u (%s)", i, _entry.segment, __func__);
+            Close();
+            return false;
+        }
+
+        if (i > 0 && _entry.counter > m_index[i - 1].counter + 1) {
+            m_lost += _entry.counter - m_index[i - 1].counter - 1;
+        }
+    }
+
+    Seek(0);
+
+    LOG_FORMAT(info, "Capture opened \"%s\" [records: %zu, segments: %u, lost: %lu] (%s)", _idx_name.c_str(), m_records, _segments, m_lost, __func__);
+    return true;
+}
+
+void GCapture::Close() {
+    for (auto& _segment : m_segments) {
+        if (_segment.first != nullptr) {
+            munmap(const_cast<uint8_t*>(_segment.first), _segment.second);
+        }
+    }
+
+    m_segments.clear();
+
+    if (m_header != nullptr) {
+        munmap(const_cast<recorder_header_t*>(m_header), m_index_size);
+    }
+
+    m_header     = nullptr;
+    m_index      = nullptr;
+    m_index_size = 0;
+    m_records    = 0;
+}
+
+bool GCapture::Verify(size_t record) const {
+    return GRecorder::Checksum(data(record), m_index[record].bytes) == m_index[record].checksum;
+}
+
+void GCapture::Seek(size_t record) {
+    m_record = std::min(record, m_records);
+    m_offset = 0;
+    m_start  = std::chrono::steady_clock::now();
+    m_stamp  = m_record < m_records ? m_index[m_record].timestamp : 0;
+}
+
+size_t GCapture::Replay(void* dst, size_t bytes, double speed, bool loop) {
+    if (m_header == nullptr || m_records == 0) {
+        return 0;
+    }
+
+    size_t _skipped{0};
+
+    // NOTE: a new record is verified and paced before its first byte
+    while (m_offset == 0) {
+        if (m_record == m_records) {
+            if (!loop) {
+                return 0;
+            }
+
+            Seek(0);
+            m_loops++;
+        }
+
+        const auto& _entry{m_index[m_record]};
+
+        if (_entry.bytes > 0 && Verify(m_record)) {
+            Pace(speed);
+            break;
+        }
+
+        m_corrupted++;
+        m_record++;
+
+        // NOTE: no valid record at all, nothing to replay
+        if (++_skipped == m_records) {
+            return 0;
+        }
+    }
+
+    const auto& _entry{m_index[m_record]};
+
+    auto _bytes{std::min(bytes, static_cast<size_t>(_entry.bytes) - m_offset)};
+
+    memcpy(dst, data(m_record) + m_offset, _bytes);
+    m_offset += _bytes;
+
+    if (m_offset == _entry.bytes) {
+        m_offset = 0;
+        m_record++;
+        m_replayed++;
+    }
+
+    return _bytes;
+}
+
+void GCapture::Pace(double speed) {
+    if (speed <= 0.0) {
+        return;
+    }
+
+    using namespace std::chrono;
+
+    auto _span{duration<double, std::nano>(static_cast<double>(m_index[m_record].timestamp - m_stamp) / speed)};
+    auto _due{m_start + duration_cast<steady_clock::duration>(_span)};
+    auto _now{steady_clock::now()};
+
+    if (_due > _now) {
+        std::this_thread::sleep_until(_due);
+        return;
+    }
+
+    // NOTE: a late record is not recovered with a burst, the schedule restarts
+    auto _gap{m_record > 0 ? static_cast<double>(m_index[m_record].timestamp - m_index[m_record - 1].timestamp) / speed : 0.0};
+
+    if (_now - _due > duration<double, std::nano>(_gap)) {
+        m_start = _now;
+        m_stamp = m_index[m_record].timestamp;
+        m_late++;
+    }
+}
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GCapture.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GCAPTURE_HPP
+#define GCAPTURE_HPP
+
+#include "GRecorder.hpp"
+
+#include <chrono>  // steady_clock
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint64_t
+#include <string>  // string
+#include <utility> // pair
+#include <vector>  // vector
+
+// Reader of the captures written by GRecorder: the index and the segments are
+// memory-mapped, so every record is accessed in place. The replay walks the
+// records in order and releases each one at its capture time divided by the
+// speed (0 for no pacing), rebased at every loop.
+
+class GCapture {
+  public:
+    // NOTE: the path given to GRecorder, e.g. "dir/name.ext"
+    GCapture(const std::string& path);
+
+    GCapture(const GCapture& capture) = delete;
+
+    ~GCapture();
+
+    GCapture& operator=(const GCapture& capture) = delete;
+
+    bool Open();
+
+    void Close();
+
+    [[nodiscard]] const recorder_index_t& index(size_t record) const {
+        return m_index[record];
+    }
+
+    // NOTE: zero-copy, the bytes stay in the mapped segment
+    [[nodiscard]] const uint8_t* data(size_t record) const {
+        return m_segments[m_index[record].segment].first + m_index[record].offset;
+    }
+
+    [[nodiscard]] bool Verify(size_t record) const;
+
+    void Seek(size_t record);
+
+    // NOTE: copies the rest of the current record (at most 'bytes'), a record
+    // never shares a call with the next one; returns 0 at the end when not looping
+    size_t Replay(void* dst, size_t bytes, double speed = 1.0, bool loop = true);
+
+    [[nodiscard]] auto is_open() const {
+        return m_header != nullptr;
+    }
+
+    [[nodiscard]] auto start_time() const {
+        return m_header->start_time;
+    }
+
+    [[nodiscard]] auto records() const {
+        return m_records;
+    }
+
+    [[nodiscard]] auto replayed() const {
+        return m_replayed;
+    }
+
+    // NOTE: records dropped at capture time, from the counter gaps
+    [[nodiscard]] auto lost() const {
+        return m_lost;
+    }
+
+    // NOTE: records skipped on a checksum mismatch
+    [[nodiscard]] auto corrupted() const {
+        return m_corrupted;
+    }
+
+    [[nodiscard]] auto late() const {
+        return m_late;
+    }
+
+    [[nodiscard]] auto loops() const {
+        return m_loops;
+    }
+
+  private:
+    void Pace(double speed);
+
+    std::string m_path;
+
+    const recorder_header_t* m_header{nullptr};
+    const recorder_index_t*  m_index{nullptr};
+    size_t                   m_index_size{0};
+    size_t                   m_records{0};
+
+    std::vector<std::pair<const uint8_t*, size_t>> m_segments;
+
+    size_t m_record{0}; // replay position
+    size_t m_offset{0}; // in the current record
+
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t                              m_stamp{0}; // timestamp at m_start
+
+    uint64_t m_replayed{0};
+    uint64_t m_lost{0};
+    uint64_t m_corrupted{0};
+    uint64_t m_late{0};
+    uint64_t m_loops{0};
+};
+
+#endif // GCAPTURE_HPP
@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GCodec.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GCodec.hpp"
+
+#include <bit>     // bit_width
+#include <cstring> // memcpy
+
+static const size_t LANE_WORDS{GCodec::BLOCK_WORDS / GCodec::BLOCK_LANES};
+
+static inline uint16_t __zigzag(uint16_t value, uint16_t pred) {
+    auto _delta{static_cast<int16_t>(value - pred)};
+
+    return static_cast<uint16_t>((_delta << 1) ^ (_delta >> 15));
+}
+
+static inline uint16_t __unzigzag(uint16_t value, uint16_t pred) {
+    return static_cast<uint16_t>(pred + ((value >> 1) ^ -(value & 1)));
+}
+
+// NOTE: word 'j' of lane 'l' is z[j * BLOCK_LANES + l], an output row holds
+// 16 bits of each lane, so a block of 'bits' width spans 'bits' rows
+static uint8_t* __pack_block(const uint16_t* z, uint8_t* dst, uint32_t bits) {
+    uint16_t _acc[GCodec::BLOCK_LANES]{};
+    uint32_t _fill{0};
+
+    for (size_t j{0}; j < LANE_WORDS; ++j) {
+        const auto* _z{z + j * GCodec::BLOCK_LANES};
+
+        for (size_t l{0}; l < GCodec::BLOCK_LANES; ++l) {
+            _acc[l] = static_cast<uint16_t>(_acc[l] | (_z[l] << _fill));
+        }
+
+        _fill += bits;
+
+        if (_fill >= 16) {
+            memcpy(dst, _acc, sizeof(_acc));
+            dst   += sizeof(_acc);
+            _fill -= 16;
+
+            for (size_t l{0}; l < GCodec::BLOCK_LANES; ++l) {
+                _acc[l] = static_cast<uint16_t>(_fill != 0 ? _z[l] >> (bits - _fill) : 0);
+            }
+        }
+    }
+    return dst;
+}
+
+static const uint8_t* __unpack_block(const uint8_t* src, uint16_t* z, uint32_t bits) {
+    uint16_t _row[GCodec::BLOCK_LANES]{};
+    uint16_t _next[GCodec::BLOCK_LANES]{};
+    uint32_t _fill{0};
+    uint32_t _mask{(1U << bits) - 1};
+
+    if (bits == 0) {
+        memset(z, 0, GCodec::BLOCK_WORDS * sizeof(uint16_t));
+        return src;
+    }
+
+    memcpy(_row, src, sizeof(_row));
+    src += sizeof(_row);
+
+    for (size_t j{0}; j < LANE_WORDS; ++j) {
+        auto* _z{z + j * GCodec::BLOCK_LANES};
+
+        if (_fill + bits <= 16) {
+            for (size_t l{0}; l < GCodec::BLOCK_LANES; ++l) {
+                _z[l] = static_cast<uint16_t>((_row[l] >> _fill) & _mask);
+            }
+            _fill += bits;
+        }
+        else {
+            // NOTE: the value straddles two rows
+            memcpy(_next, src, sizeof(_next));
+            src += sizeof(_next);
+
+            for (size_t l{0}; l < GCodec::BLOCK_LANES; ++l) {
+                _z[l] = static_cast<uint16_t>(((_row[l] >> _fill) | (_next[l] << (16 - _fill))) & _mask);
+                _row[l] = _next[l];
+            }
+            _fill = _fill + bits - 16;
+        }
+
+        if (_fill == 16 && j + 1 < LANE_WORDS) {
+            memcpy(_row, src, sizeof(_row));
+            src   += sizeof(_row);
+            _fill  = 0;
+        }
+    }
+    return src;
+}
+
+GCodec::GCodec(size_t max_words) {
+    m_max_words = max_words;
+    m_zigzag.resize((max_words + BLOCK_WORDS - 1) / BLOCK_WORDS * BLOCK_WORDS);
+}
+
+size_t GCodec::MaxEncodedBytes(size_t words) {
+    auto _blocks{(words + BLOCK_WORDS - 1) / BLOCK_WORDS};
+
+    return sizeof(uint32_t) + _blocks * (1 + BLOCK_WORDS * sizeof(uint16_t));
+}
+
+size_t GCodec::Encode(const uint16_t* src, size_t words, uint8_t* dst, size_t dst_size) {
+    if (words == 0 || words > m_max_words) {
+        return 0;
+    }
+
+    auto* _z{m_zigzag.data()};
+
+    for (size_t i{0}; i < DELTA_STRIDE && i < words; ++i) {
+        _z[i] = __zigzag(src[i], 0);
+    }
+
+    for (size_t i{DELTA_STRIDE}; i < words; ++i) {
+        _z[i] = __zigzag(src[i], src[i - DELTA_STRIDE]);
+    }
+
+    auto _padded{(words + BLOCK_WORDS - 1) / BLOCK_WORDS * BLOCK_WORDS};
+
+    for (size_t i{words}; i < _padded; ++i) {
+        _z[i] = 0;
+    }
+
+    const auto  _raw_bytes{words * sizeof(uint16_t)};
+    const auto* _end{dst + dst_size};
+    auto*       _dst{dst};
+    auto        _words{static_cast<uint32_t>(words)};
+
+    m_raw_bytes   += _raw_bytes;
+    m_coded_bytes += _raw_bytes;
+
+    if (dst_size < sizeof(_words)) {
+        return 0;
+    }
+
+    memcpy(_dst, &_words, sizeof(_words));
+    _dst += sizeof(_words);
+
+    for (size_t b{0}; b < _padded; b += BLOCK_WORDS) {
+        uint16_t _or{0};
+
+        for (size_t i{0}; i < BLOCK_WORDS; ++i) {
+            _or = static_cast<uint16_t>(_or | _z[b + i]);
+        }
+
+        auto _bits{static_cast<uint32_t>(std::bit_width(_or))};
+        auto _need{1 + _bits * BLOCK_LANES * sizeof(uint16_t)};
+
+        // NOTE: the message does not shrink, the caller sends it RAW
+        if (_dst + _need > _end || static_cast<size_t>(_dst - dst) + _need >= _raw_bytes) {
+            return 0;
+        }
+
+        *_dst++ = static_cast<uint8_t>(_bits);
+        _dst    = __pack_block(_z + b, _dst, _bits);
+    }
+
+    auto _bytes{static_cast<size_t>(_dst - dst)};
+
+    m_coded_bytes -= _raw_bytes - _bytes;
+    return _bytes;
+}
+
+size_t GCodec::Decode(const uint8_t* src, size_t bytes, uint16_t* dst, size_t dst_words) {
+    uint32_t _words{0};
+
+    if (bytes < sizeof(_words)) {
+        return 0;
+    }
+
+    memcpy(&_words, src, sizeof(_words));
+
+    if (_words == 0 || _words > dst_words || _words > m_max_words) {
+        return 0;
+    }
+
+    const auto* _end{src + bytes};
+    const auto* _src{src + sizeof(_words)};
+    auto*       _z{m_zigzag.data()};
+    auto        _padded{(_words + BLOCK_WORDS - 1) / BLOCK_WORDS * BLOCK_WORDS};
+
+    for (size_t b{0}; b < _padded; b += BLOCK_WORDS) {
+        if (_src >= _end) {
+            return 0;
+        }
+
+        auto _bits{static_cast<uint32_t>(*_src++)};
+
+        if (_bits > 16 || _src + _bits * BLOCK_LANES * sizeof(uint16_t) > _end) {
+            return 0;
+        }
+
+        _src = __unpack_block(_src, _z + b, _bits);
+    }
+
+    for (size_t i{0}; i < DELTA_STRIDE && i < _words; ++i) {
+        dst[i] = __unzigzag(_z[i], 0);
+    }
+
+    // NOTE: the prefix sum is serial per channel, the only non-vector step
+    for (size_t i{DELTA_STRIDE}; i < _words; ++i) {
+        dst[i] = __unzigzag(_z[i], dst[i - DELTA_STRIDE]);
+    }
+
+    return _words;
+}
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GCodec.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GCODEC_HPP
+#define GCODEC_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint16_t, uint32_t, uint64_t
+#include <vector>  // vector
+
+// Delta plus bit-packing codec for 16-bit sample words (I, Q interleaved).
+//
+// message: [u32 words] [block 0] [block 1] ...
+// block  : [u8 bits] [bits * 16 bytes] for BLOCK_WORDS zigzag deltas
+//
+// Every message is self-contained (UDP losses do not propagate). The deltas
+// are taken per channel and packed vertically in 8 lanes of 16 bits, so the
+// lane loops vectorize without any shuffle.
+
+class GCodec {
+  public:
+    enum codec_t : uint8_t { RAW = 0, DELTA_PACK = 1 };
+
+    static const size_t BLOCK_WORDS  = 128;
+    static const size_t BLOCK_LANES  = 8;
+    static const size_t DELTA_STRIDE = 2;
+
+    GCodec(size_t max_words);
+
+    GCodec(const GCodec& codec) = delete;
+
+    GCodec& operator=(const GCodec& codec) = delete;
+
+    static size_t MaxEncodedBytes(size_t words);
+
+    // NOTE: returns 0 when the message does not shrink (send it RAW)
+    size_t Encode(const uint16_t* src, size_t words, uint8_t* dst, size_t dst_size);
+
+    // NOTE: returns 0 on a malformed message
+    size_t Decode(const uint8_t* src, size_t bytes, uint16_t* dst, size_t dst_words);
+
+    [[nodiscard]] auto max_words() const {
+        return m_max_words;
+    }
+
+    [[nodiscard]] auto raw_bytes() const {
+        return m_raw_bytes;
+    }
+
+    // NOTE: RAW fallbacks are accounted with their own size
+    [[nodiscard]] auto coded_bytes() const {
+        return m_coded_bytes;
+    }
+
+  private:
+    size_t                m_max_words;
+    uint64_t              m_raw_bytes{0};
+    uint64_t              m_coded_bytes{0};
+    std::vector<uint16_t> m_zigzag;
+};
+
+#endif // GCODEC_HPP
@@ -27,6 +27,11 @@ class GEncoder {
         m_file_id        = file_id;
     }
 
+    // NOTE: sent in the 'spare_0' header byte of every packet (0: raw data)
+    void SetCodec(uint8_t codec) {
+        m_codec = codec;
+    }
+
     void Reset() {
         m_fifo.Reset();
     }
@@ -37,6 +42,7 @@ class GEncoder {
         auto result{false};
 
         m_packet.head.packet_type     = packet_type;
+        m_packet.head.spare_0         = m_codec;
         m_packet.head.packet_counter  = m_packet_counter++;
         m_packet.head.current_segment = 1;
 
@@ -96,6 +102,7 @@ class GEncoder {
   private:
     uint32_t m_packet_counter;
     uint32_t m_file_id;
+    uint8_t  m_codec{0};
     packet_t m_packet;
     GFiFo    m_fifo;
 };
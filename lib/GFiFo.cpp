@@ -1,4 +1,3 @@
-
 ////////////////////////////////////////////////////////////////////////////////
 /// \file      GFiFo.cpp
 /// \version   0.1
@@ -9,15 +8,17 @@
 
 #include "GFiFo.hpp"
 
-#include "GDefine.hpp" // DO_IF, GOTO_IF, RETURN_IF
+#include "GDefine.hpp" // BREAK_IF, DO_IF, RETURN_IF
+#include "GWait.hpp"   // GWait
 
 #include <algorithm> // min
 
-GFiFo::GFiFo(const uint32_t item_size, const uint32_t fifo_depth, const int max_level, const int min_level) {
+GFiFo::GFiFo(const uint32_t item_size, const uint32_t fifo_depth, const int max_level, const int min_level, const access_t access) {
+    m_access    = access;
     m_size      = item_size;
-    m_depth     = fifo_depth;
-    m_max_level = max_level < 1 ? -1 : std::min(max_level, static_cast<int>(fifo_depth));
-    m_min_level = min_level < 0 ? -1 : std::min(min_level, static_cast<int>(fifo_depth));
+    m_depth     = std::min(fifo_depth, CLOSED - 1);
+    m_max_level = max_level < 1 ? -1 : std::min(max_level, static_cast<int>(m_depth));
+    m_min_level = min_level < 0 ? -1 : std::min(min_level, static_cast<int>(m_depth));
 
     if ((m_size > 0) && (m_depth > 0)) {
         p_fifo = new GBuffer*[m_depth];
@@ -25,6 +26,8 @@ GFiFo::GFiFo(const uint32_t item_size, const uint32_t fifo_depth, const int max_
         for (decltype(m_depth) i{0}; i < m_depth; ++i) {
             p_fifo[i] = new GBuffer(m_size);
         }
+
+        DO_IF(m_access == MPMC_ACCESS, p_turns = new std::atomic<uint64_t>[m_depth]);
     }
 
     Reset();
@@ -38,26 +41,32 @@ GFiFo::~GFiFo() {
 
     delete[] p_fifo;
     p_fifo = nullptr;
+
+    delete[] p_turns;
+    p_turns = nullptr;
 }
 
 void GFiFo::wipe_resources() {
-    m_max_level = 0;
-    m_used      = 0;
-    m_iW        = 0;
-    m_iR        = 0;
+    m_max_used = 0;
+    m_iW       = 0;
+    m_iR       = 0;
 
-    if (m_max_level >= 1 && m_min_level >= 0 && m_max_level > m_min_level) {
-        m_fsm_level = MIN_LEVEL_PASSED;
-    }
-    else {
-        m_fsm_level = TRANSITION_OFF;
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    m_level.store(0, std::memory_order_release);
+
+    // NOTE: the slot 'i' is free for the producer holding the position 'i'
+    for (decltype(m_depth) i{0}; p_turns != nullptr && i < m_depth; ++i) {
+        p_turns[i].store(i, std::memory_order_relaxed);
     }
+
+    m_fsm_on = m_max_level >= 1 && m_min_level >= 0 && m_max_level > m_min_level;
+
+    m_fsm_event[PRODUCER_SIDE].store(0, std::memory_order_relaxed);
+    m_fsm_event[CONSUMER_SIDE].store(0, std::memory_order_relaxed);
 }
 
 void GFiFo::Reset() {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
     RETURN_IF(p_fifo == nullptr, wipe_resources());
 
     for (decltype(m_depth) i{0}; i < m_depth; ++i) {
@@ -66,9 +75,6 @@ void GFiFo::Reset() {
 }
 
 void GFiFo::Clear() {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
     RETURN_IF(p_fifo == nullptr, wipe_resources());
 
     for (decltype(m_depth) i{0}; i < m_depth; ++i) {
@@ -77,9 +83,6 @@ void GFiFo::Clear() {
 }
 
 void GFiFo::SmartClear() {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
     RETURN_IF(p_fifo == nullptr, wipe_resources());
 
     for (decltype(m_depth) i{0}; i < m_depth; ++i) {
@@ -87,91 +90,209 @@ void GFiFo::SmartClear() {
     }
 }
 
-bool GFiFo::Push(const GBuffer* src_buff) {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
+void GFiFo::wake_waiters() {
+    DO_IF(m_waiters.load(std::memory_order_seq_cst) > 0, GWait::Wake(m_level));
+}
 
-    const bool error_1 = src_buff == nullptr;
-    const bool error_2 = IsFull();
+void GFiFo::fsm_record(const fsm_side_t side, const uint32_t old_level, const uint32_t new_level) {
+    RETURN_IF(!m_fsm_on, );
 
-    if (error_1 || error_2) {
+    const auto _old{fsm_classify(old_level)};
+    const auto _new{fsm_classify(new_level)};
+
+    RETURN_IF(_old == _new, );
+
+    auto& _event{m_fsm_event[side]};
+    auto  _pending{_event.load(std::memory_order_relaxed)};
+    auto  _next{_pending};
+
+    // NOTE: a transition not reported yet keeps its old level, the new one is replaced
+    do {
+        const auto _first{(_pending & FSM_PENDING) != 0 ? static_cast<fsm_levels_t>((_pending >> 4) & 0xF) : _old};
+
+        _next = _first != _new ? FSM_PENDING | static_cast<uint32_t>(_first) << 4 | static_cast<uint32_t>(_new) : 0;
+    } while (!_event.compare_exchange_weak(_pending, _next, std::memory_order_acq_rel));
+}
+
+bool GFiFo::write_item(const uint8_t* src_data, const uint32_t src_count) {
+    if (m_access == SPSC_ACCESS) {
+        GBuffer* _item = p_fifo[m_iW];
+
+        _item->Reset();
+
+        if (_item->Append(src_data, src_count)) {
+            ++m_iW;
+
+            if (m_iW == m_depth) {
+                m_iW = 0;
+            }
+
+            // NOTE: the item is published with the level, the consumer is woken only if parked
+            auto _level{m_level.fetch_add(1, std::memory_order_seq_cst) & ~CLOSED};
+            wake_waiters();
+
+            fsm_record(PRODUCER_SIDE, _level, _level + 1);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // NOTE: a claimed slot must be published, so the item has to fit
+    if (src_count > m_size) {
         return false;
     }
 
-    GBuffer* _item = p_fifo[m_iW];
+    auto _pos{m_tail.load(std::memory_order_relaxed)};
+
+    while (true) {
+        auto _diff{static_cast<int64_t>(p_turns[_pos % m_depth].load(std::memory_order_acquire) - _pos)};
+
+        if (_diff == 0) {
+            BREAK_IF(m_tail.compare_exchange_weak(_pos, _pos + 1, std::memory_order_relaxed), );
+        }
+        else if (_diff < 0) {
+            return false; // NOTE: full, the consumer of the slot is not done yet
+        }
+        else {
+            _pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    GBuffer* _item = p_fifo[_pos % m_depth];
 
     _item->Reset();
+    _item->Append(src_data, src_count);
+
+    p_turns[_pos % m_depth].store(_pos + 1, std::memory_order_release);
 
-    if (_item->Append(src_buff->data(), src_buff->used())) {
-        ++m_iW;
-        ++m_used;
+    auto _level{m_level.fetch_add(1, std::memory_order_seq_cst) & ~CLOSED};
+    wake_waiters();
 
-        if (m_iW == m_depth) {
-            m_iW = 0;
+    fsm_record(PRODUCER_SIDE, _level, _level + 1);
+    return true;
+}
+
+GBuffer* GFiFo::read_start(uint64_t& ticket) {
+    if (m_access == SPSC_ACCESS) {
+        return p_fifo[m_iR];
+    }
+
+    auto _state{m_level.load(std::memory_order_acquire)};
+
+    // NOTE: a unit of the level is taken first, so a published item waits for this consumer
+    do {
+        if ((_state & ~CLOSED) == 0) {
+            return nullptr;
         }
+    } while (!m_level.compare_exchange_weak(_state, _state - 1, std::memory_order_seq_cst));
 
-        return true;
+    fsm_record(CONSUMER_SIDE, _state & ~CLOSED, (_state & ~CLOSED) - 1);
+
+    ticket = m_head.fetch_add(1, std::memory_order_relaxed);
+
+    // NOTE: the producer of the slot may still be copying (a few ns)
+    while (p_turns[ticket % m_depth].load(std::memory_order_acquire) != ticket + 1) {
+        GWait::Relax();
     }
 
-    return false;
+    return p_fifo[ticket % m_depth];
 }
 
-bool GFiFo::Push(const uint8_t* src_data, const uint32_t src_count) {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
+void GFiFo::read_stop(const uint64_t ticket) {
+    if (m_access == SPSC_ACCESS) {
+        ++m_iR;
 
-    const bool error_1 = src_data == nullptr;
-    const bool error_2 = src_count == 0;
-    const bool error_3 = IsFull();
+        if (m_iR == m_depth) {
+            m_iR = 0;
+        }
 
-    if (error_1 || error_2 || error_3) {
-        return false;
+        // NOTE: the slot is handed back with the level, the producer is woken only if parked
+        auto _level{m_level.fetch_sub(1, std::memory_order_seq_cst) & ~CLOSED};
+        wake_waiters();
+
+        fsm_record(CONSUMER_SIDE, _level, _level - 1);
+        return;
     }
 
-    GBuffer* _item = p_fifo[m_iW];
+    // NOTE: the slot is free for the producer holding the position 'ticket + depth'
+    p_turns[ticket % m_depth].store(ticket + m_depth, std::memory_order_seq_cst);
+    wake_waiters();
+}
 
-    _item->Reset();
+bool GFiFo::wait_level(const uint32_t level, const std::chrono::steady_clock::time_point* deadline) {
+    auto _state{m_level.load(std::memory_order_acquire)};
 
-    if (_item->Append(src_data, src_count)) {
-        ++m_iW;
-        ++m_used;
+    // NOTE: fast path, no syscall while the level is not the awaited one
+    if ((_state & ~CLOSED) != level || (_state & CLOSED) != 0) {
+        return (_state & ~CLOSED) != level;
+    }
 
-        if (m_iW == m_depth) {
-            m_iW = 0;
+    // NOTE: the waiters count and the level are both sequentially consistent,
+    // so either the other side sees the waiter or the waiter sees the change
+    m_waiters.fetch_add(1, std::memory_order_seq_cst);
+
+    while (true) {
+        _state = m_level.load(std::memory_order_seq_cst);
+
+        BREAK_IF((_state & ~CLOSED) != level || (_state & CLOSED) != 0, );
+
+        if (!GWait::Park(m_level, _state, deadline)) {
+            _state = m_level.load(std::memory_order_acquire);
+            break;
         }
+    }
 
-        return true;
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+    return (_state & ~CLOSED) != level;
+}
+
+bool GFiFo::Push(const GBuffer* src_buff) {
+    const bool error_1 = src_buff == nullptr;
+    const bool error_2 = IsFull();
+
+    if (error_1 || error_2) {
+        return false;
     }
 
-    return false;
+    return write_item(src_buff->data(), src_buff->used());
 }
 
-bool GFiFo::Pop(GBuffer* dst_buff) {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
+bool GFiFo::Push(const uint8_t* src_data, const uint32_t src_count) {
+    const bool error_1 = src_data == nullptr;
+    const bool error_2 = src_count == 0;
+    const bool error_3 = IsFull();
+
+    if (error_1 || error_2 || error_3) {
+        return false;
+    }
 
+    return write_item(src_data, src_count);
+}
+
+bool GFiFo::Pop(GBuffer* dst_buff) {
     const bool error_1 = dst_buff == nullptr;
     const bool error_2 = IsEmpty();
+    const bool error_3 = !error_1 && m_access == MPMC_ACCESS && dst_buff->size() < m_size;
 
-    if (error_1 || error_2) {
+    if (error_1 || error_2 || error_3) {
         return false;
     }
 
-    GBuffer* _item = p_fifo[m_iR];
+    uint64_t _ticket{0};
+    GBuffer* _item = read_start(_ticket);
+
+    if (_item == nullptr) {
+        return false;
+    }
 
     dst_buff->Reset();
 
+    // NOTE: SPSC_ACCESS, on failure the item is left in the ring
     if (dst_buff->Append(_item->data(), _item->used())) {
-        ++m_iR;
-        --m_used;
-
-        if (m_iR == m_depth) {
-            m_iR = 0;
-        }
-
+        read_stop(_ticket);
         return true;
     }
 
@@ -179,10 +300,6 @@ bool GFiFo::Pop(GBuffer* dst_buff) {
 }
 
 int32_t GFiFo::Pop(uint8_t* dst_data, const uint32_t dst_size) {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
-
     const bool error_1 = dst_data == nullptr;
     const bool error_2 = dst_size == 0;
     const bool error_3 = IsEmpty();
@@ -191,57 +308,123 @@ int32_t GFiFo::Pop(uint8_t* dst_data, const uint32_t dst_size) {
         return false;
     }
 
-    GBuffer* _item = p_fifo[m_iR];
+    // NOTE: MPMC_ACCESS, checked before a slot is claimed, so the item is kept
+    if (m_access == MPMC_ACCESS && dst_size < m_size) {
+        return -1;
+    }
+
+    uint64_t _ticket{0};
+    GBuffer* _item = read_start(_ticket);
+
+    if (_item == nullptr) {
+        return false;
+    }
+
     uint32_t bytes = _item->used();
 
     if (dst_size >= bytes) {
         memcpy(static_cast<void*>(dst_data), static_cast<void*>(_item->data()), bytes);
 
-        ++m_iR;
-        --m_used;
+        read_stop(_ticket);
+        return (int32_t)bytes;
+    }
 
-        if (m_iR == m_depth) {
-            m_iR = 0;
+    return -1;
+}
+
+static inline auto __deadline(const std::chrono::nanoseconds timeout, std::chrono::steady_clock::time_point* deadline) {
+    *deadline = timeout != GFiFo::NEVER ? std::chrono::steady_clock::now() + timeout : std::chrono::steady_clock::time_point::max();
+
+    return timeout != GFiFo::NEVER ? deadline : nullptr;
+}
+
+bool GFiFo::PushWait(const GBuffer* src_buff, const std::chrono::nanoseconds timeout) {
+    if (p_fifo == nullptr || src_buff == nullptr || src_buff->used() > m_size) {
+        return false;
+    }
+
+    return PushWait(src_buff->data(), src_buff->used(), timeout);
+}
+
+bool GFiFo::PushWait(const uint8_t* src_data, const uint32_t src_count, const std::chrono::nanoseconds timeout) {
+    if (p_fifo == nullptr || src_data == nullptr || src_count == 0 || src_count > m_size) {
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point _deadline;
+    const auto*                           _until{__deadline(timeout, &_deadline)};
+
+    // NOTE: MPMC_ACCESS, a slot counted as free may still be read by its consumer
+    while (!IsClosed() && wait_level(m_depth, _until)) {
+        if (Push(src_data, src_count)) {
+            return true;
         }
 
-        return (int32_t)bytes;
+        GWait::Relax();
     }
 
-    return -1;
+    return false;
 }
 
-bool GFiFo::IsLevelChanged(fsm_levels_t* new_fsm_level, fsm_levels_t* old_fsm_level) {
-#ifdef GFIFO_THREAD_SAFE
-    std::lock_guard<std::mutex> lock(m_mutex);
-#endif
+bool GFiFo::PopWait(GBuffer* dst_buff, const std::chrono::nanoseconds timeout) {
+    if (p_fifo == nullptr || dst_buff == nullptr || (m_access == MPMC_ACCESS && dst_buff->size() < m_size)) {
+        return false;
+    }
 
-    auto _state_changed{false};
+    std::chrono::steady_clock::time_point _deadline;
+    const auto*                           _until{__deadline(timeout, &_deadline)};
 
-    auto _current_level{static_cast<int>(m_used)};
+    // NOTE: MPMC_ACCESS, another consumer may take the item first
+    while (wait_level(0, _until)) {
+        if (Pop(dst_buff)) {
+            return true;
+        }
 
-    DO_IF(old_fsm_level != nullptr, *old_fsm_level = m_fsm_level);
+        // NOTE: SPSC_ACCESS, the only consumer failed on a pending item, it does not fit
+        if (m_access == SPSC_ACCESS && !IsEmpty()) {
+            return false;
+        }
+    }
 
-    GOTO_IF(m_fsm_level == TRANSITION_OFF, label_exit, );
+    return false;
+}
 
-    if (m_min_level < _current_level && _current_level < m_max_level) {
-        _state_changed = m_fsm_level != REGULAR_LEVEL;
-        m_fsm_level    = REGULAR_LEVEL;
-        goto label_exit;
+int32_t GFiFo::PopWait(uint8_t* dst_data, const uint32_t dst_size, const std::chrono::nanoseconds timeout) {
+    if (p_fifo == nullptr || dst_data == nullptr || dst_size == 0) {
+        return false;
     }
 
-    if (_current_level >= m_max_level) {
-        _state_changed = m_fsm_level != MAX_LEVEL_PASSED;
-        m_fsm_level    = MAX_LEVEL_PASSED;
-        goto label_exit;
+    std::chrono::steady_clock::time_point _deadline;
+    const auto*                           _until{__deadline(timeout, &_deadline)};
+
+    while (wait_level(0, _until)) {
+        auto _bytes{Pop(dst_data, dst_size)};
+
+        if (_bytes != 0) {
+            return _bytes;
+        }
     }
 
-    if (_current_level <= m_min_level) {
-        _state_changed = m_fsm_level != MIN_LEVEL_PASSED;
-        m_fsm_level    = MIN_LEVEL_PASSED;
+    return false;
+}
+
+void GFiFo::Close() {
+    m_level.fetch_or(CLOSED, std::memory_order_seq_cst);
+    DO_IF(m_waiters.load(std::memory_order_seq_cst) > 0, GWait::Wake(m_level));
+}
+
+bool GFiFo::IsLevelChanged(const fsm_side_t side, fsm_levels_t* new_fsm_level, fsm_levels_t* old_fsm_level) {
+    auto _event{m_fsm_event[side].exchange(0, std::memory_order_acq_rel)};
+    auto _old_level{fsm_level()};
+    auto _new_level{_old_level};
+
+    if ((_event & FSM_PENDING) != 0) {
+        _old_level = static_cast<fsm_levels_t>((_event >> 4) & 0xF);
+        _new_level = static_cast<fsm_levels_t>(_event & 0xF);
     }
 
-label_exit:
-    DO_IF(new_fsm_level != nullptr, *new_fsm_level = m_fsm_level);
+    DO_IF(old_fsm_level != nullptr, *old_fsm_level = _old_level);
+    DO_IF(new_fsm_level != nullptr, *new_fsm_level = _new_level);
 
-    return _state_changed;
+    return _new_level != _old_level;
 }
@@ -12,13 +12,25 @@
 
 #include "GBuffer.hpp" // GBuffer
 
-// #define GFIFO_THREAD_SAFE
-
-#ifdef GFIFO_THREAD_SAFE
-#include <mutex>
-#else
-#define GFIFO_LOCK_GUARD
-#endif
+#include <atomic>  // atomic
+#include <chrono>  // nanoseconds, steady_clock
+#include <cstdint> // uint32_t, uint64_t
+
+// Lock-free ring with two access modes:
+//
+// SPSC_ACCESS : one producer and one consumer, each side owns its index and
+//               the level is the only shared word
+// MPMC_ACCESS : any number of producers and consumers, every slot carries a
+//               turn number (D. Vyukov's bounded queue), a consumer takes a
+//               unit of the level before it claims the next slot
+//
+// The blocking calls park on the level word (a futex) while the ring is empty
+// (PopWait) or full (PushWait), the other side wakes them only if somebody is
+// parked. The level FSM works the same in both modes: a transition belongs to
+// the side whose push or pop crosses the threshold, so the producer is the one
+// to see MAX_LEVEL_PASSED and the consumer the one to see MIN_LEVEL_PASSED.
+//
+// WARNING: Reset, Clear and SmartClear need the producers and the consumers idle
 
 class GFiFo {
   public:
@@ -30,7 +42,13 @@ class GFiFo {
 
     } fsm_levels_t;
 
-    GFiFo(uint32_t item_size, uint32_t fifo_depth, int max_level = -1, int min_level = -1);
+    typedef enum { PRODUCER_SIDE, CONSUMER_SIDE } fsm_side_t;
+
+    typedef enum { SPSC_ACCESS, MPMC_ACCESS } access_t;
+
+    static constexpr std::chrono::nanoseconds NEVER{std::chrono::nanoseconds::max()};
+
+    GFiFo(uint32_t item_size, uint32_t fifo_depth, int max_level = -1, int min_level = -1, access_t access = SPSC_ACCESS);
 
     GFiFo(const GFiFo& other) = delete;
 
@@ -48,20 +66,44 @@ class GFiFo {
 
     bool Push(const uint8_t* src_data, uint32_t src_count);
 
+    // NOTE: false (-1) if the item does not fit, the item is kept. MPMC_ACCESS, the
+    // destination must hold any item (size() bytes), a slot claimed is never undone
     bool Pop(GBuffer* dst_buff);
 
     int32_t Pop(uint8_t* dst_data, uint32_t dst_size);
 
-    bool IsLevelChanged(fsm_levels_t* new_fsm_level = nullptr, fsm_levels_t* old_fsm_level = nullptr);
+    // NOTE: false on timeout or if closed
+    bool PushWait(const GBuffer* src_buff, std::chrono::nanoseconds timeout = NEVER);
+
+    bool PushWait(const uint8_t* src_data, uint32_t src_count, std::chrono::nanoseconds timeout = NEVER);
+
+    // NOTE: false (0) on timeout or if closed and empty, the pending items are still popped,
+    // false (-1) at once if the item does not fit
+    bool PopWait(GBuffer* dst_buff, std::chrono::nanoseconds timeout = NEVER);
+
+    int32_t PopWait(uint8_t* dst_data, uint32_t dst_size, std::chrono::nanoseconds timeout = NEVER);
+
+    // NOTE: releases the parked threads for good (until the next Reset)
+    void Close();
+
+    // NOTE: reports the transitions crossed by the pushes (or the pops) since the last
+    // call for the same side, folded into one from the first old level to the last new
+    bool IsLevelChanged(fsm_side_t side, fsm_levels_t* new_fsm_level = nullptr, fsm_levels_t* old_fsm_level = nullptr);
 
-    // WARNING: thread unsafe
     [[nodiscard]] auto IsEmpty() const {
-        return (m_used == 0);
+        return (used() == 0);
     }
 
-    // WARNING: thread unsafe
     [[nodiscard]] auto IsFull() const {
-        return (m_used == m_depth);
+        return (used() == m_depth);
+    }
+
+    [[nodiscard]] auto IsClosed() const {
+        return (m_level.load(std::memory_order_acquire) & CLOSED) != 0;
+    }
+
+    [[nodiscard]] auto access() const {
+        return m_access;
     }
 
     [[nodiscard]] auto size() const {
@@ -80,48 +122,72 @@ class GFiFo {
         return m_min_level;
     }
 
-    // WARNING: thread unsafe
     [[nodiscard]] auto fsm_level() const {
-        return m_fsm_level;
+        return m_fsm_on ? fsm_classify(used()) : TRANSITION_OFF;
     }
 
     // WARNING: thread unsafe
     [[nodiscard]] auto max_used() {
-        if (m_max_used < m_used) {
-            m_max_used = m_used;
+        if (m_max_used < used()) {
+            m_max_used = used();
         }
         return m_max_used;
     }
 
-    // WARNING: thread unsafe
-    [[nodiscard]] auto used() const {
-        return m_used;
+    [[nodiscard]] uint32_t used() const {
+        return m_level.load(std::memory_order_acquire) & ~CLOSED;
     }
 
-    // WARNING: thread unsafe
     [[nodiscard]] auto free() const {
-        return m_depth - m_used;
+        return m_depth - used();
     }
 
   private:
+    static const uint32_t CLOSED = 0x80000000; // NOTE: in the level word, so a close wakes the parked threads
+
+    static const uint32_t FSM_PENDING = 0x100; // NOTE: in the event word, with the old level << 4 and the new one
+
     uint32_t m_size;
     uint32_t m_depth;
     int      m_max_level;
     int      m_min_level;
+    access_t m_access;
 
-    fsm_levels_t m_fsm_level;
-    uint32_t     m_max_used;
+    bool     m_fsm_on;
+    uint32_t m_max_used;
+
+    std::atomic<uint32_t> m_fsm_event[2]; // NOTE: one per side, the transition not reported yet
 
     GBuffer** p_fifo{nullptr};
-    uint32_t  m_used;
-    uint32_t  m_iR;
-    uint32_t  m_iW;
+    uint32_t  m_iR; // NOTE: SPSC_ACCESS, consumer side
+    uint32_t  m_iW; // NOTE: SPSC_ACCESS, producer side
+
+    std::atomic<uint64_t>* p_turns{nullptr}; // NOTE: MPMC_ACCESS, one per slot
 
-#ifdef GFIFO_THREAD_SAFE
-    std::mutex m_mutex;
-#endif
+    alignas(64) std::atomic<uint64_t> m_head{0}; // NOTE: MPMC_ACCESS, consumers side
+    alignas(64) std::atomic<uint64_t> m_tail{0}; // NOTE: MPMC_ACCESS, producers side
+    alignas(64) std::atomic<uint32_t> m_level{0};
+    std::atomic<uint32_t>             m_waiters{0};
 
     void wipe_resources();
+
+    bool write_item(const uint8_t* src_data, uint32_t src_count);
+
+    GBuffer* read_start(uint64_t& ticket);
+
+    void read_stop(uint64_t ticket);
+
+    void wake_waiters();
+
+    void fsm_record(fsm_side_t side, uint32_t old_level, uint32_t new_level);
+
+    [[nodiscard]] fsm_levels_t fsm_classify(uint32_t level) const {
+        const auto _level{static_cast<int>(level)};
+
+        return _level >= m_max_level ? MAX_LEVEL_PASSED : _level <= m_min_level ? MIN_LEVEL_PASSED : REGULAR_LEVEL;
+    }
+
+    bool wait_level(uint32_t level, const std::chrono::steady_clock::time_point* deadline);
 };
 
 #endif // GFIFO_HPP
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GMemory.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GMEMORY_HPP
+#define GMEMORY_HPP
+
+#include "GDefine.hpp" // DO_IF
+#include "GLogger.hpp" // LOG_FORMAT
+
+#include <alloca.h>       // alloca
+#include <atomic>         // atomic_ref
+#include <cerrno>         // errno
+#include <cstddef>        // size_t
+#include <cstdint>        // uint8_t
+#include <cstring>        // strerror
+#include <sys/mman.h>     // mlockall, MCL_CURRENT, MCL_FUTURE
+#include <sys/resource.h> // getrlimit, getrusage, RLIMIT_MEMLOCK, RUSAGE_THREAD
+#include <unistd.h>       // sysconf
+
+// Real-time memory helpers: locking the process pages, touching buffers and
+// thread stacks ahead of time, counting the page faults of a thread.
+
+typedef struct memory_faults {
+    long minor{0};
+    long major{0};
+} memory_faults_t;
+
+class GMemory {
+  public:
+    // NOTE: the current and future pages stay resident (and are faulted in now)
+    static bool LockAll() {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            rlimit _limit{};
+            getrlimit(RLIMIT_MEMLOCK, &_limit);
+
+            LOG_FORMAT(warning, "Unable to lock the memory: %s [RLIMIT_MEMLOCK: %llu] (%s)", strerror(errno), (unsigned long long)_limit.rlim_cur, __func__);
+            return false;
+        }
+
+        LOG_FORMAT(info, "Memory locked (%s)", __func__);
+        return true;
+    }
+
+    // NOTE: one write per page (a read-modify-write, so a single fault), the content is preserved
+    static void Prefault(void* data, size_t bytes) {
+        auto*      _data{static_cast<uint8_t*>(data)};
+        const auto _page{PageBytes()};
+
+        for (size_t i{0}; i < bytes; i += _page) {
+            std::atomic_ref<uint8_t>(_data[i]).fetch_or(0, std::memory_order_relaxed);
+        }
+
+        DO_IF(bytes > 0, std::atomic_ref<uint8_t>(_data[bytes - 1]).fetch_or(0, std::memory_order_relaxed));
+    }
+
+    // NOTE: the calling thread stack, down to 'bytes' below the caller frame
+    [[gnu::noinline]] static void PrefaultStack(size_t bytes) {
+        Prefault(alloca(bytes), bytes);
+    }
+
+    // NOTE: the calling thread counters since its start
+    static memory_faults_t Faults() {
+        rusage _usage{};
+        getrusage(RUSAGE_THREAD, &_usage);
+
+        return {_usage.ru_minflt, _usage.ru_majflt};
+    }
+
+    static size_t PageBytes() {
+        static const auto _page{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+
+        return _page;
+    }
+};
+
+#endif // GMEMORY_HPP
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GPlayer.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GPlayer.hpp"
+
+#include "GLogger.hpp"
+
+#include <algorithm>  // min
+#include <cerrno>     // errno
+#include <cstring>    // memcpy, strerror
+#include <fcntl.h>    // open
+#include <sys/mman.h> // madvise, mmap, munmap
+#include <sys/stat.h> // fstat
+#include <thread>     // sleep_until
+#include <unistd.h>   // close
+
+GPlayer::GPlayer(const std::string& path, size_t word_bytes, bool loop, double rate) {
+    m_path       = path;
+    m_word_bytes = word_bytes > 0 ? word_bytes : 1;
+    m_loop       = loop;
+    m_rate       = rate > 0.0 ? rate : 0.0;
+}
+
+GPlayer::~GPlayer() {
+    Close();
+}
+
+bool GPlayer::Open() {
+    if (m_data != nullptr) {
+        return true;
+    }
+
+    auto _fd{open(m_path.c_str(), O_RDONLY)};
+
+    if (_fd < 0) {
+        LOG_FORMAT(error, "Unable to open \"%s\": %s (%s)", m_path.c_str(), strerror(errno), __func__);
+        return false;
+    }
+
+    struct stat _st {};
+
+    if (fstat(_fd, &_st) != 0 || _st.st_size < static_cast<off_t>(m_word_bytes)) {
+        LOG_FORMAT(error, "Unable to play \"%s\": no words (%s)", m_path.c_str(), __func__);
+        close(_fd);
+        return false;
+    }
+
+    // NOTE: the trailing partial word is never played
+    m_size = static_cast<size_t>(_st.st_size) / m_word_bytes * m_word_bytes;
+
+    // NOTE: the pages are read ahead here, not at the first loop
+    auto* _map{mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, _fd, 0)};
+    close(_fd);
+
+    if (_map == MAP_FAILED) {
+        LOG_FORMAT(error, "Unable to map \"%s\": %s (%s)", m_path.c_str(), strerror(errno), __func__);
+        m_size = 0;
+        return false;
+    }
+
+    madvise(_map, m_size, MADV_SEQUENTIAL);
+
+    m_data   = static_cast<const uint8_t*>(_map);
+    m_offset = 0;
+    m_loops  = 0;
+    m_words  = 0;
+    m_late   = 0;
+    m_start  = std::chrono::steady_clock::now();
+
+    LOG_FORMAT(info, "Player opened \"%s\" [words: %zu, loop: %d, rate: %0.0f] (%s)", m_path.c_str(), file_words(), m_loop, m_rate, __func__);
+    return true;
+}
+
+void GPlayer::Close() {
+    if (m_data == nullptr) {
+        return;
+    }
+
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+}
+
+size_t GPlayer::Read(void* dst, size_t words) {
+    if (m_data == nullptr) {
+        return 0;
+    }
+
+    auto* _dst{static_cast<uint8_t*>(dst)};
+    auto  _need{words * m_word_bytes};
+    size_t _done{0};
+
+    while (_done < _need) {
+        if (m_offset == m_size) {
+            if (!m_loop) {
+                break;
+            }
+
+            m_offset = 0;
+            m_loops++;
+        }
+
+        auto _bytes{std::min(_need - _done, m_size - m_offset)};
+
+        memcpy(_dst + _done, m_data + m_offset, _bytes);
+        m_offset += _bytes;
+        _done    += _bytes;
+    }
+
+    auto _words{_done / m_word_bytes};
+
+    Pace(_words);
+    return _words;
+}
+
+void GPlayer::Pace(size_t words) {
+    m_words += words;
+
+    if (m_rate == 0.0 || words == 0) {
+        return;
+    }
+
+    using namespace std::chrono;
+
+    auto _due{m_start + duration_cast<steady_clock::duration>(duration<double>(static_cast<double>(m_words) / m_rate))};
+    auto _now{steady_clock::now()};
+
+    if (_due > _now) {
+        std::this_thread::sleep_until(_due);
+        return;
+    }
+
+    // NOTE: a late chunk is not recovered with a burst, the schedule restarts
+    if (_now - _due > duration<double>(static_cast<double>(words) / m_rate)) {
+        m_start = _now - duration_cast<steady_clock::duration>(duration<double>(static_cast<double>(m_words) / m_rate));
+        m_late++;
+    }
+}
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GPlayer.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GPLAYER_HPP
+#define GPLAYER_HPP
+
+#include <chrono>  // steady_clock
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint64_t
+#include <string>  // string
+
+// Memory-mapped file player: the file is mapped once and walked in chunks of
+// words, wrapping to its head when looping (a chunk may span the file end and
+// the file head, so the replayed stream has no gaps). An optional word rate
+// paces the chunks against the steady clock.
+
+class GPlayer {
+  public:
+    GPlayer(const std::string& path, size_t word_bytes, bool loop = true, double rate = 0.0);
+
+    GPlayer(const GPlayer& player) = delete;
+
+    ~GPlayer();
+
+    GPlayer& operator=(const GPlayer& player) = delete;
+
+    bool Open();
+
+    void Close();
+
+    // NOTE: returns the words copied, 0 at the file end when not looping
+    size_t Read(void* dst, size_t words);
+
+    [[nodiscard]] auto is_open() const {
+        return m_data != nullptr;
+    }
+
+    [[nodiscard]] auto file_words() const {
+        return m_size / m_word_bytes;
+    }
+
+    [[nodiscard]] auto loops() const {
+        return m_loops;
+    }
+
+    [[nodiscard]] auto words() const {
+        return m_words;
+    }
+
+    // NOTE: times the player was late by more than a chunk
+    [[nodiscard]] auto late() const {
+        return m_late;
+    }
+
+  private:
+    void Pace(size_t words);
+
+    std::string m_path;
+    size_t      m_word_bytes;
+    bool        m_loop;
+    double      m_rate;
+
+    const uint8_t* m_data{nullptr};
+    size_t         m_size{0};
+    size_t         m_offset{0};
+
+    std::chrono::steady_clock::time_point m_start;
+
+    uint64_t m_loops{0};
+    uint64_t m_words{0};
+    uint64_t m_late{0};
+};
+
+#endif // GPLAYER_HPP
@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GRecorder.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GRecorder.hpp"
+
+#include "GLogger.hpp"
+
+#include <cerrno>     // errno
+#include <cstdlib>    // aligned_alloc, free
+#include <cstring>    // memcpy, memset, strerror
+#include <fcntl.h>    // fallocate, open, O_DIRECT
+#include <filesystem> // path
+#include <sys/uio.h>  // iovec, pwritev
+#include <unistd.h>   // close, ftruncate
+
+static inline size_t __aligned(size_t bytes) {
+    return (bytes + GRecorder::ALIGNMENT - 1) / GRecorder::ALIGNMENT * GRecorder::ALIGNMENT;
+}
+
+GRecorder::GRecorder(const std::string& path, size_t record_bytes, size_t slots, uint64_t segment_bytes) {
+    m_path          = path;
+    m_slot_bytes    = __aligned(record_bytes);
+    m_slots         = slots > 0 ? slots : 1;
+    m_segment_bytes = segment_bytes > m_slot_bytes ? segment_bytes : m_slot_bytes;
+
+    m_lengths.resize(m_slots);
+    m_counters.resize(m_slots);
+    m_stamps.resize(m_slots);
+}
+
+GRecorder::~GRecorder() {
+    Stop();
+
+    if (m_staging != nullptr) {
+        std::free(m_staging);
+        m_staging = nullptr;
+    }
+}
+
+bool GRecorder::Start() {
+    if (m_thread.joinable()) {
+        return true;
+    }
+
+    if (m_staging == nullptr) {
+        m_staging = static_cast<uint8_t*>(std::aligned_alloc(ALIGNMENT, m_slot_bytes * m_slots));
+
+        if (m_staging == nullptr) {
+            LOG_FORMAT(error, "Unable to allocate %zu staging bytes (%s)", m_slot_bytes * m_slots, __func__);
+            return false;
+        }
+    }
+
+    auto _path{std::filesystem::path(m_path)};
+    auto _name{_path.parent_path() / _path.stem()};
+    _name += ".idx";
+
+    m_index = fopen(_name.c_str(), "wb");
+
+    if (m_index == nullptr) {
+        LOG_FORMAT(error, "Unable to open \"%s\": %s (%s)", _name.c_str(), strerror(errno), __func__);
+        return false;
+    }
+
+    recorder_header_t _header{MAGIC, VERSION, sizeof(recorder_index_t), ALIGNMENT, 0, 0};
+
+    m_start            = std::chrono::steady_clock::now();
+    m_pushes           = 0;
+    _header.start_time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+    fwrite(&_header, sizeof(_header), 1, m_index);
+
+    m_segment = 0;
+
+    if (!OpenSegment()) {
+        fclose(m_index);
+        m_index = nullptr;
+        return false;
+    }
+
+    m_quit   = false;
+    m_thread = std::thread(&GRecorder::Worker, this);
+    return true;
+}
+
+void GRecorder::Stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    m_quit = true;
+    m_wake.fetch_add(1, std::memory_order_release);
+    m_wake.notify_one();
+    m_thread.join();
+
+    CloseSegment();
+
+    if (m_index != nullptr) {
+        fclose(m_index);
+        m_index = nullptr;
+    }
+
+    LOG_FORMAT(info, "Recorder stopped [records: %llu, dropped: %llu, segments: %u, direct: %d] (%s)", (unsigned long long)records(), (unsigned long long)dropped(), m_segment, m_direct, __func__);
+}
+
+uint32_t GRecorder::Checksum(const void* data, size_t bytes) {
+    const auto* _src{static_cast<const uint8_t*>(data)};
+    uint32_t    _sum1{0xFFFF};
+    uint32_t    _sum2{0xFFFF};
+    auto        _words{bytes / 2};
+
+    // NOTE: 359 words is the longest run without a 32-bit overflow
+    while (_words > 0) {
+        auto _run{_words < 359 ? _words : 359};
+        _words -= _run;
+
+        for (size_t i{0}; i < _run; ++i, _src += 2) {
+            _sum1 += static_cast<uint32_t>(_src[0] | (_src[1] << 8));
+            _sum2 += _sum1;
+        }
+
+        _sum1 = (_sum1 & 0xFFFF) + (_sum1 >> 16);
+        _sum2 = (_sum2 & 0xFFFF) + (_sum2 >> 16);
+    }
+
+    if ((bytes & 1) != 0) {
+        _sum1 += _src[0];
+        _sum2 += _sum1;
+    }
+
+    _sum1 = (_sum1 & 0xFFFF) + (_sum1 >> 16);
+    _sum2 = (_sum2 & 0xFFFF) + (_sum2 >> 16);
+    _sum1 = (_sum1 & 0xFFFF) + (_sum1 >> 16);
+    _sum2 = (_sum2 & 0xFFFF) + (_sum2 >> 16);
+
+    return (_sum2 << 16) | _sum1;
+}
+
+bool GRecorder::Push(const void* data, size_t bytes) {
+    const auto _head{m_head.load(std::memory_order_relaxed)};
+    const auto _counter{m_pushes++};
+
+    if (bytes == 0 || bytes > m_slot_bytes || _head - m_tail.load(std::memory_order_acquire) >= m_slots) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto  _slot{_head % m_slots};
+    auto* _dst{m_staging + _slot * m_slot_bytes};
+
+    memcpy(_dst, data, bytes);
+    memset(_dst + bytes, 0, __aligned(bytes) - bytes);
+    m_lengths[_slot]  = static_cast<uint32_t>(bytes);
+    m_counters[_slot] = _counter;
+    m_stamps[_slot]   = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+
+    m_head.store(_head + 1, std::memory_order_release);
+    m_wake.fetch_add(1, std::memory_order_release);
+    m_wake.notify_one();
+    return true;
+}
+
+bool GRecorder::OpenSegment() {
+    char _tail[32];
+    snprintf(_tail, sizeof(_tail), "_%06u", m_segment);
+
+    auto _path{std::filesystem::path(m_path)};
+    auto _name{_path.parent_path() / _path.stem()};
+    _name += _tail;
+    _name += _path.extension();
+
+    m_direct = true;
+    m_fd     = open(_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+
+    // NOTE: e.g. tmpfs, the page cache is used instead
+    if (m_fd < 0 && errno == EINVAL) {
+        m_direct = false;
+        m_fd     = open(_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+
+    if (m_fd < 0) {
+        LOG_FORMAT(error, "Unable to open \"%s\": %s (%s)", _name.c_str(), strerror(errno), __func__);
+        return false;
+    }
+
+    // NOTE: best effort, extents are reserved once instead of at every write
+    if (fallocate(m_fd, 0, 0, static_cast<off_t>(m_segment_bytes)) != 0) {
+        LOG_FORMAT(warning, "Unable to preallocate \"%s\": %s (%s)", _name.c_str(), strerror(errno), __func__);
+    }
+
+    m_offset = 0;
+    return true;
+}
+
+void GRecorder::CloseSegment() {
+    if (m_fd < 0) {
+        return;
+    }
+
+    // NOTE: the unused preallocation is released
+    if (ftruncate(m_fd, static_cast<off_t>(m_offset)) != 0) {
+        LOG_FORMAT(warning, "Unable to truncate segment %u: %s (%s)", m_segment, strerror(errno), __func__);
+    }
+
+    close(m_fd);
+    m_fd = -1;
+    m_segment++;
+}
+
+void GRecorder::Worker() {
+    auto _tail{m_tail.load(std::memory_order_relaxed)};
+
+    while (true) {
+        auto _wake{m_wake.load(std::memory_order_acquire)};
+        auto _head{m_head.load(std::memory_order_acquire)};
+
+        if (_head == _tail) {
+            if (m_quit) {
+                break;
+            }
+
+            m_wake.wait(_wake, std::memory_order_acquire);
+            continue;
+        }
+
+        // NOTE: one gathered write, up to the batch max and the segment end
+        struct iovec     _iov[BATCH_MAX];
+        recorder_index_t _idx[BATCH_MAX];
+        size_t           _num{0};
+        uint64_t         _len{0};
+
+        if (m_fd < 0 || m_offset + __aligned(m_lengths[_tail % m_slots]) > m_segment_bytes) {
+            CloseSegment();
+
+            if (!OpenSegment()) {
+                // NOTE: the pending records are dropped, the producer is never blocked
+                m_dropped.fetch_add(_head - _tail, std::memory_order_relaxed);
+                _tail = _head;
+                m_tail.store(_tail, std::memory_order_release);
+                continue;
+            }
+        }
+
+        while (_tail + _num < _head && _num < BATCH_MAX) {
+            auto _slot{(_tail + _num) % m_slots};
+            auto _size{__aligned(m_lengths[_slot])};
+
+            if (_num > 0 && m_offset + _len + _size > m_segment_bytes) {
+                break;
+            }
+
+            _iov[_num].iov_base = m_staging + _slot * m_slot_bytes;
+            _iov[_num].iov_len  = _size;
+            _idx[_num]          = {static_cast<uint32_t>(_tail + _num), m_segment, m_offset + _len, m_lengths[_slot], 0, m_counters[_slot], m_stamps[_slot]};
+
+            // NOTE: the checksum is taken here, off the producer path
+            _idx[_num].checksum = Checksum(_iov[_num].iov_base, m_lengths[_slot]);
+
+            _len += _size;
+            _num++;
+        }
+
+        auto _done{pwritev(m_fd, _iov, static_cast<int>(_num), static_cast<off_t>(m_offset))};
+
+        if (_done != static_cast<ssize_t>(_len)) {
+            LOG_FORMAT(error, "Unable to write segment %u: %s (%s)", m_segment, strerror(errno), __func__);
+            m_dropped.fetch_add(_num, std::memory_order_relaxed);
+        }
+        else {
+            fwrite(_idx, sizeof(recorder_index_t), _num, m_index);
+
+            m_offset += _len;
+            m_records.fetch_add(_num, std::memory_order_relaxed);
+            m_bytes.fetch_add(_len, std::memory_order_relaxed);
+        }
+
+        _tail += _num;
+        m_tail.store(_tail, std::memory_order_release);
+    }
+}
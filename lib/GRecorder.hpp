@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GRecorder.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRECORDER_HPP
+#define GRECORDER_HPP
+
+#include <atomic>  // atomic
+#include <chrono>  // steady_clock
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint32_t, uint64_t
+#include <cstdio>  // FILE
+#include <string>  // string
+#include <thread>  // thread
+#include <vector>  // vector
+
+// Asynchronous file recorder: the caller copies each record into a staging
+// slot and returns, a writer thread stores the slots in large preallocated
+// segment files (O_DIRECT when the file system allows it) and rotates them
+// by size. Every record is listed in an index file next to the segments.
+//
+// path "dir/name.ext" -> segments "dir/name_000000.ext", index "dir/name.idx"
+//
+// index: [recorder_header_t] [recorder_index_t 0] [recorder_index_t 1] ...
+//
+// The index entries have a fixed size, so record 'i' is found by seeking to
+// sizeof(recorder_header_t) + i * sizeof(recorder_index_t) (see GCapture).
+
+typedef struct recorder_header {
+    uint32_t magic;      // GRecorder::MAGIC
+    uint16_t version;    // GRecorder::VERSION
+    uint16_t index_bytes;
+    uint32_t alignment;
+    uint32_t reserved;
+    uint64_t start_time; // ns since the epoch (system clock) at Start
+} recorder_header_t;
+
+typedef struct recorder_index {
+    uint32_t sequence;  // accepted records before this one
+    uint32_t segment;
+    uint64_t offset;    // in the segment, aligned to GRecorder::ALIGNMENT
+    uint32_t bytes;
+    uint32_t checksum;  // GRecorder::Checksum of the record bytes
+    uint64_t counter;   // Push calls before this one, a gap means dropped records
+    uint64_t timestamp; // ns since Start (steady clock) at Push
+} recorder_index_t;
+
+class GRecorder {
+  public:
+    static const size_t ALIGNMENT = 4096;
+    static const size_t BATCH_MAX = 16;
+
+    static const uint32_t MAGIC   = 0x43455247; // "GREC"
+    static const uint16_t VERSION = 1;
+
+    GRecorder(const std::string& path, size_t record_bytes, size_t slots = 32, uint64_t segment_bytes = 1ULL << 30);
+
+    GRecorder(const GRecorder& recorder) = delete;
+
+    ~GRecorder();
+
+    GRecorder& operator=(const GRecorder& recorder) = delete;
+
+    bool Start();
+
+    // NOTE: pending records are written before returning
+    void Stop();
+
+    // NOTE: never blocks, returns false if the record is dropped (no free slot)
+    bool Push(const void* data, size_t bytes);
+
+    // NOTE: Fletcher-32 over 16-bit little-endian words
+    static uint32_t Checksum(const void* data, size_t bytes);
+
+    [[nodiscard]] auto records() const {
+        return m_records.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto dropped() const {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto bytes() const {
+        return m_bytes.load(std::memory_order_relaxed);
+    }
+
+  private:
+    bool OpenSegment();
+    void CloseSegment();
+    void Worker();
+
+    std::string m_path;
+    size_t      m_slot_bytes;
+    size_t      m_slots;
+    uint64_t    m_segment_bytes;
+
+    uint8_t*              m_staging{nullptr};
+    std::vector<uint32_t> m_lengths;
+    std::vector<uint64_t> m_counters;
+    std::vector<uint64_t> m_stamps;
+
+    std::atomic<uint64_t> m_head{0}; // written by Push
+    std::atomic<uint64_t> m_tail{0}; // written by the worker
+    std::atomic<uint32_t> m_wake{0};
+    std::atomic<bool>     m_quit{false};
+    std::thread           m_thread;
+
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t                              m_pushes{0}; // written by Push
+
+    int      m_fd{-1};
+    bool     m_direct{false};
+    uint32_t m_segment{0};
+    uint64_t m_offset{0};
+    FILE*    m_index{nullptr};
+
+    std::atomic<uint64_t> m_records{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<uint64_t> m_bytes{0};
+};
+
+#endif // GRECORDER_HPP
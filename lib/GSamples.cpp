@@ -0,0 +1,461 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GSamples.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GSamples.hpp"
+
+#include <cmath> // lrintf
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GSAMPLES_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define GSAMPLES_NEON
+#endif
+
+typedef struct kernels {
+    void (*sign_extend_12)(uint16_t*, size_t);
+    void (*byte_swap)(uint16_t*, size_t);
+    void (*deinterleave)(const int16_t*, int16_t*, int16_t*, size_t);
+    void (*interleave)(const int16_t*, const int16_t*, int16_t*, size_t);
+    void (*to_float)(const int16_t*, float*, size_t, float);
+    void (*from_float)(const float*, int16_t*, size_t, float);
+} kernels_t;
+
+// SECTION: scalar reference
+
+static void scalar_sign_extend_12(uint16_t* data, size_t words) {
+    for (size_t n{0}; n < words; ++n) {
+        data[n] = static_cast<uint16_t>(static_cast<int16_t>(data[n] << 4) >> 4);
+    }
+}
+
+static void scalar_byte_swap(uint16_t* data, size_t words) {
+    for (size_t n{0}; n < words; ++n) {
+        data[n] = static_cast<uint16_t>((data[n] >> 8) | (data[n] << 8));
+    }
+}
+
+static void scalar_deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs) {
+    for (size_t n{0}; n < pairs; ++n) {
+        i[n] = iq[2 * n + 0];
+        q[n] = iq[2 * n + 1];
+    }
+}
+
+static void scalar_interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs) {
+    for (size_t n{0}; n < pairs; ++n) {
+        iq[2 * n + 0] = i[n];
+        iq[2 * n + 1] = q[n];
+    }
+}
+
+static void scalar_to_float(const int16_t* src, float* dst, size_t words, float scale) {
+    for (size_t n{0}; n < words; ++n) {
+        dst[n] = static_cast<float>(src[n]) * scale;
+    }
+}
+
+static void scalar_from_float(const float* src, int16_t* dst, size_t words, float scale) {
+    for (size_t n{0}; n < words; ++n) {
+        auto _value{src[n] * scale};
+
+        _value = _value < -32768.0F ? -32768.0F : _value;
+        _value = _value > +32767.0F ? +32767.0F : _value;
+        dst[n] = static_cast<int16_t>(std::lrintf(_value));
+    }
+}
+
+static const kernels_t scalar_kernels{
+    scalar_sign_extend_12, scalar_byte_swap, scalar_deinterleave, scalar_interleave, scalar_to_float, scalar_from_float,
+};
+
+#if defined(GSAMPLES_X86)
+
+// SECTION: SSE2 kernels (x86-64 baseline)
+
+static void sse2_sign_extend_12(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto* _p{reinterpret_cast<__m128i*>(data + n)};
+        auto  _v{_mm_loadu_si128(_p)};
+
+        _mm_storeu_si128(_p, _mm_srai_epi16(_mm_slli_epi16(_v, 4), 4));
+    }
+    scalar_sign_extend_12(data + n, words - n);
+}
+
+static void sse2_byte_swap(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto* _p{reinterpret_cast<__m128i*>(data + n)};
+        auto  _v{_mm_loadu_si128(_p)};
+
+        _mm_storeu_si128(_p, _mm_or_si128(_mm_slli_epi16(_v, 8), _mm_srli_epi16(_v, 8)));
+    }
+    scalar_byte_swap(data + n, words - n);
+}
+
+static void sse2_deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 8 <= pairs; n += 8) {
+        auto _a{_mm_loadu_si128(reinterpret_cast<const __m128i*>(iq + 2 * n + 0))};
+        auto _b{_mm_loadu_si128(reinterpret_cast<const __m128i*>(iq + 2 * n + 8))};
+
+        // NOTE: I is the low half of each 32-bit lane, Q the high one
+        auto _i{_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(_a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(_b, 16), 16))};
+        auto _q{_mm_packs_epi32(_mm_srai_epi32(_a, 16), _mm_srai_epi32(_b, 16))};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(i + n), _i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(q + n), _q);
+    }
+    scalar_deinterleave(iq + 2 * n, i + n, q + n, pairs - n);
+}
+
+static void sse2_interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 8 <= pairs; n += 8) {
+        auto _i{_mm_loadu_si128(reinterpret_cast<const __m128i*>(i + n))};
+        auto _q{_mm_loadu_si128(reinterpret_cast<const __m128i*>(q + n))};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(iq + 2 * n + 0), _mm_unpacklo_epi16(_i, _q));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(iq + 2 * n + 8), _mm_unpackhi_epi16(_i, _q));
+    }
+    scalar_interleave(i + n, q + n, iq + 2 * n, pairs - n);
+}
+
+static void sse2_to_float(const int16_t* src, float* dst, size_t words, float scale) {
+    size_t n{0};
+    auto   _scale{_mm_set1_ps(scale)};
+
+    for (; n + 8 <= words; n += 8) {
+        auto _v{_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n))};
+        auto _lo{_mm_srai_epi32(_mm_unpacklo_epi16(_v, _v), 16)};
+        auto _hi{_mm_srai_epi32(_mm_unpackhi_epi16(_v, _v), 16)};
+
+        _mm_storeu_ps(dst + n + 0, _mm_mul_ps(_mm_cvtepi32_ps(_lo), _scale));
+        _mm_storeu_ps(dst + n + 4, _mm_mul_ps(_mm_cvtepi32_ps(_hi), _scale));
+    }
+    scalar_to_float(src + n, dst + n, words - n, scale);
+}
+
+static void sse2_from_float(const float* src, int16_t* dst, size_t words, float scale) {
+    size_t n{0};
+    auto   _scale{_mm_set1_ps(scale)};
+    auto   _min{_mm_set1_ps(-32768.0F)};
+    auto   _max{_mm_set1_ps(+32767.0F)};
+
+    // NOTE: clamped before the conversion, out of range floats become INT32_MIN
+    for (; n + 8 <= words; n += 8) {
+        auto _lo{_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + n + 0), _scale), _min), _max)};
+        auto _hi{_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + n + 4), _scale), _min), _max)};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n), _mm_packs_epi32(_mm_cvtps_epi32(_lo), _mm_cvtps_epi32(_hi)));
+    }
+    scalar_from_float(src + n, dst + n, words - n, scale);
+}
+
+static const kernels_t sse2_kernels{
+    sse2_sign_extend_12, sse2_byte_swap, sse2_deinterleave, sse2_interleave, sse2_to_float, sse2_from_float,
+};
+
+// SECTION: AVX2 kernels (selected at run time)
+
+#define GSAMPLES_AVX2 __attribute__((target("avx2")))
+
+GSAMPLES_AVX2 static void avx2_sign_extend_12(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 16 <= words; n += 16) {
+        auto* _p{reinterpret_cast<__m256i*>(data + n)};
+        auto  _v{_mm256_loadu_si256(_p)};
+
+        _mm256_storeu_si256(_p, _mm256_srai_epi16(_mm256_slli_epi16(_v, 4), 4));
+    }
+    sse2_sign_extend_12(data + n, words - n);
+}
+
+GSAMPLES_AVX2 static void avx2_byte_swap(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 16 <= words; n += 16) {
+        auto* _p{reinterpret_cast<__m256i*>(data + n)};
+        auto  _v{_mm256_loadu_si256(_p)};
+
+        _mm256_storeu_si256(_p, _mm256_or_si256(_mm256_slli_epi16(_v, 8), _mm256_srli_epi16(_v, 8)));
+    }
+    sse2_byte_swap(data + n, words - n);
+}
+
+GSAMPLES_AVX2 static void avx2_deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 16 <= pairs; n += 16) {
+        auto _a{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(iq + 2 * n + 0))};
+        auto _b{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(iq + 2 * n + 16))};
+
+        auto _i{_mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(_a, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(_b, 16), 16))};
+        auto _q{_mm256_packs_epi32(_mm256_srai_epi32(_a, 16), _mm256_srai_epi32(_b, 16))};
+
+        // NOTE: the packs work per 128-bit lane, the 64-bit quarters are reordered
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(i + n), _mm256_permute4x64_epi64(_i, 0xD8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(q + n), _mm256_permute4x64_epi64(_q, 0xD8));
+    }
+    sse2_deinterleave(iq + 2 * n, i + n, q + n, pairs - n);
+}
+
+GSAMPLES_AVX2 static void avx2_interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 16 <= pairs; n += 16) {
+        auto _i{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + n))};
+        auto _q{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + n))};
+        auto _lo{_mm256_unpacklo_epi16(_i, _q)};
+        auto _hi{_mm256_unpackhi_epi16(_i, _q)};
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(iq + 2 * n + 0), _mm256_permute2x128_si256(_lo, _hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(iq + 2 * n + 16), _mm256_permute2x128_si256(_lo, _hi, 0x31));
+    }
+    sse2_interleave(i + n, q + n, iq + 2 * n, pairs - n);
+}
+
+GSAMPLES_AVX2 static void avx2_to_float(const int16_t* src, float* dst, size_t words, float scale) {
+    size_t n{0};
+    auto   _scale{_mm256_set1_ps(scale)};
+
+    for (; n + 16 <= words; n += 16) {
+        auto _lo{_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n + 0)))};
+        auto _hi{_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n + 8)))};
+
+        _mm256_storeu_ps(dst + n + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(_lo), _scale));
+        _mm256_storeu_ps(dst + n + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_hi), _scale));
+    }
+    sse2_to_float(src + n, dst + n, words - n, scale);
+}
+
+GSAMPLES_AVX2 static void avx2_from_float(const float* src, int16_t* dst, size_t words, float scale) {
+    size_t n{0};
+    auto   _scale{_mm256_set1_ps(scale)};
+    auto   _min{_mm256_set1_ps(-32768.0F)};
+    auto   _max{_mm256_set1_ps(+32767.0F)};
+
+    for (; n + 16 <= words; n += 16) {
+        auto _lo{_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + n + 0), _scale), _min), _max)};
+        auto _hi{_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + n + 8), _scale), _min), _max)};
+        auto _v{_mm256_packs_epi32(_mm256_cvtps_epi32(_lo), _mm256_cvtps_epi32(_hi))};
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n), _mm256_permute4x64_epi64(_v, 0xD8));
+    }
+    sse2_from_float(src + n, dst + n, words - n, scale);
+}
+
+static const kernels_t avx2_kernels{
+    avx2_sign_extend_12, avx2_byte_swap, avx2_deinterleave, avx2_interleave, avx2_to_float, avx2_from_float,
+};
+
+#endif // GSAMPLES_X86
+
+#if defined(GSAMPLES_NEON)
+
+// SECTION: NEON kernels
+
+static void neon_sign_extend_12(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto _v{vreinterpretq_s16_u16(vld1q_u16(data + n))};
+
+        vst1q_u16(data + n, vreinterpretq_u16_s16(vshrq_n_s16(vshlq_n_s16(_v, 4), 4)));
+    }
+    scalar_sign_extend_12(data + n, words - n);
+}
+
+static void neon_byte_swap(uint16_t* data, size_t words) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto _v{vreinterpretq_u8_u16(vld1q_u16(data + n))};
+
+        vst1q_u16(data + n, vreinterpretq_u16_u8(vrev16q_u8(_v)));
+    }
+    scalar_byte_swap(data + n, words - n);
+}
+
+static void neon_deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 8 <= pairs; n += 8) {
+        auto _v{vld2q_s16(iq + 2 * n)};
+
+        vst1q_s16(i + n, _v.val[0]);
+        vst1q_s16(q + n, _v.val[1]);
+    }
+    scalar_deinterleave(iq + 2 * n, i + n, q + n, pairs - n);
+}
+
+static void neon_interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs) {
+    size_t n{0};
+
+    for (; n + 8 <= pairs; n += 8) {
+        int16x8x2_t _v{{vld1q_s16(i + n), vld1q_s16(q + n)}};
+
+        vst2q_s16(iq + 2 * n, _v);
+    }
+    scalar_interleave(i + n, q + n, iq + 2 * n, pairs - n);
+}
+
+static void neon_to_float(const int16_t* src, float* dst, size_t words, float scale) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto _v{vld1q_s16(src + n)};
+
+        vst1q_f32(dst + n + 0, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(_v))), scale));
+        vst1q_f32(dst + n + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(_v))), scale));
+    }
+    scalar_to_float(src + n, dst + n, words - n, scale);
+}
+
+#if defined(__aarch64__)
+static void neon_from_float(const float* src, int16_t* dst, size_t words, float scale) {
+    size_t n{0};
+
+    for (; n + 8 <= words; n += 8) {
+        auto _lo{vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + n + 0), scale))};
+        auto _hi{vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + n + 4), scale))};
+
+        vst1q_s16(dst + n, vcombine_s16(vqmovn_s32(_lo), vqmovn_s32(_hi)));
+    }
+    scalar_from_float(src + n, dst + n, words - n, scale);
+}
+#else
+// NOTE: ARMv7 has no round to nearest conversion, the scalar one is kept
+#define neon_from_float scalar_from_float
+#endif
+
+static const kernels_t neon_kernels{
+    neon_sign_extend_12, neon_byte_swap, neon_deinterleave, neon_interleave, neon_to_float, neon_from_float,
+};
+
+#endif // GSAMPLES_NEON
+
+// SECTION: dispatcher
+
+static const kernels_t* __kernels(GSamples::isa_t isa) {
+    switch (isa) {
+#if defined(GSAMPLES_X86)
+        case GSamples::SSE2:
+            return &sse2_kernels;
+        case GSamples::AVX2:
+            return &avx2_kernels;
+#elif defined(GSAMPLES_NEON)
+        case GSamples::NEON:
+            return &neon_kernels;
+#endif
+        default:
+            return &scalar_kernels;
+    }
+}
+
+static GSamples::isa_t __best_isa() {
+#if defined(GSAMPLES_X86)
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx2") ? GSamples::AVX2 : GSamples::SSE2;
+#elif defined(GSAMPLES_NEON)
+    return GSamples::NEON;
+#else
+    return GSamples::SCALAR;
+#endif
+}
+
+// NOTE: function statics, safe to use from other static initializers
+static GSamples::isa_t& __isa() {
+    static GSamples::isa_t _isa{__best_isa()};
+    return _isa;
+}
+
+static const kernels_t*& __active() {
+    static const kernels_t* _kernels{__kernels(__isa())};
+    return _kernels;
+}
+
+GSamples::isa_t GSamples::Isa() {
+    return __isa();
+}
+
+const char* GSamples::IsaName(isa_t isa) {
+    switch (isa) {
+        case SCALAR:
+            return "SCALAR";
+        case SSE2:
+            return "SSE2";
+        case AVX2:
+            return "AVX2";
+        case NEON:
+            return "NEON";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+bool GSamples::IsaSupported(isa_t isa) {
+    switch (isa) {
+        case SCALAR:
+            return true;
+#if defined(GSAMPLES_X86)
+        case SSE2:
+            return true;
+        case AVX2:
+            return __best_isa() == AVX2;
+#elif defined(GSAMPLES_NEON)
+        case NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool GSamples::IsaForce(isa_t isa) {
+    if (!IsaSupported(isa)) {
+        return false;
+    }
+
+    __isa()    = isa;
+    __active() = __kernels(isa);
+    return true;
+}
+
+void GSamples::SignExtend12(uint16_t* data, size_t words) {
+    __active()->sign_extend_12(data, words);
+}
+
+void GSamples::ByteSwap(uint16_t* data, size_t words) {
+    __active()->byte_swap(data, words);
+}
+
+void GSamples::Deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs) {
+    __active()->deinterleave(iq, i, q, pairs);
+}
+
+void GSamples::Interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs) {
+    __active()->interleave(i, q, iq, pairs);
+}
+
+void GSamples::ToFloat(const int16_t* src, float* dst, size_t words, float scale) {
+    __active()->to_float(src, dst, words, scale);
+}
+
+void GSamples::FromFloat(const float* src, int16_t* dst, size_t words, float scale) {
+    __active()->from_float(src, dst, words, scale);
+}
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GSamples.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GSAMPLES_HPP
+#define GSAMPLES_HPP
+
+#include "GArray.hpp"
+
+#include <cstddef> // size_t
+#include <cstdint> // int16_t, uint16_t
+
+// NOTE: the kernels are selected once at the first call (SSE2/AVX2 on x86-64,
+// NEON on ARM) and fall back to the scalar reference for the array tails.
+
+class GSamples {
+  public:
+    enum isa_t { SCALAR = 0, SSE2, AVX2, NEON, ISA_NUM };
+
+    static isa_t Isa();
+
+    static const char* IsaName(isa_t isa);
+
+    static bool IsaSupported(isa_t isa);
+
+    // NOTE: benchmarks only, not thread safe against running kernels
+    static bool IsaForce(isa_t isa);
+
+    // 12-bit samples (FIFO words) to int16, in place
+    static void SignExtend12(uint16_t* data, size_t words);
+
+    // 16-bit big/little endian swap, in place
+    static void ByteSwap(uint16_t* data, size_t words);
+
+    // I, Q, I, Q, ... to I, I, ... and Q, Q, ... (buffers must not overlap)
+    static void Deinterleave(const int16_t* iq, int16_t* i, int16_t* q, size_t pairs);
+
+    static void Interleave(const int16_t* i, const int16_t* q, int16_t* iq, size_t pairs);
+
+    static void ToFloat(const int16_t* src, float* dst, size_t words, float scale);
+
+    // NOTE: rounded to nearest and saturated to the int16 range
+    static void FromFloat(const float* src, int16_t* dst, size_t words, float scale);
+
+    static void SignExtend12(GArray<uint16_t>& array) {
+        SignExtend12(array.data(), array.used());
+    }
+
+    static void ByteSwap(GArray<uint16_t>& array) {
+        ByteSwap(array.data(), array.used());
+    }
+};
+
+#endif // GSAMPLES_HPP
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GThread.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GThread.hpp"
+
+#include "GDefine.hpp" // LOG_IF
+#include "GLogger.hpp" // LOG_FORMAT
+
+#include <cstdio>         // fgets, fopen, sscanf
+#include <cstring>        // strerror, strncmp
+#include <pthread.h>      // pthread_self, pthread_setaffinity_np, pthread_setname_np
+#include <sched.h>        // CPU_SET, SCHED_FIFO, SCHED_RR, sched_param
+#include <strings.h>      // strcasecmp
+#include <sys/resource.h> // getrlimit, RLIMIT_RTPRIO
+#include <unistd.h>       // geteuid, sysconf
+
+static const int CAP_SYS_NICE_BIT{23};
+
+// NOTE: effective capabilities from procfs, so libcap is not needed
+static bool __has_cap_sys_nice() {
+    auto* _file{fopen("/proc/self/status", "r")};
+
+    if (_file == nullptr) {
+        return false;
+    }
+
+    char               _line[256];
+    unsigned long long _caps{0};
+
+    while (fgets(_line, sizeof(_line), _file) != nullptr) {
+        if (strncmp(_line, "CapEff:", 7) == 0) {
+            sscanf(_line + 7, "%llx", &_caps);
+            break;
+        }
+    }
+
+    fclose(_file);
+    return ((_caps >> CAP_SYS_NICE_BIT) & 1) != 0;
+}
+
+bool GThread::Parse(const std::string& spec, thread_config_t* config) {
+    auto _cpu{-1};
+    auto _policy{SCHED_OTHER};
+    auto _priority{0};
+
+    if (!spec.empty()) {
+        const auto* _spec{spec.c_str()};
+        const auto  _size{(int)spec.size()};
+
+        char _name[16]{};
+        auto _used{-1};
+
+        // NOTE: one format per field count, the whole spec must be consumed
+        auto _valid{(sscanf(_spec, "%d%n", &_cpu, &_used) == 1 && _used == _size) ||
+                    (sscanf(_spec, "%d,%15[A-Za-z]%n", &_cpu, _name, &_used) == 2 && _used == _size) ||
+                    (sscanf(_spec, "%d,%15[A-Za-z],%d%n", &_cpu, _name, &_priority, &_used) == 3 && _used == _size)};
+
+        if (!_valid || (_name[0] != '\0' && strcasecmp(_name, "other") != 0 && strcasecmp(_name, "fifo") != 0 && strcasecmp(_name, "rr") != 0)) {
+            LOG_FORMAT(error, "Invalid thread spec \"%s\" (%s)", spec.c_str(), __func__);
+            return false;
+        }
+
+        _policy = strcasecmp(_name, "fifo") == 0 ? SCHED_FIFO : strcasecmp(_name, "rr") == 0 ? SCHED_RR : SCHED_OTHER;
+    }
+
+    if (_policy != SCHED_OTHER && (_priority < sched_get_priority_min(_policy) || _priority > sched_get_priority_max(_policy))) {
+        LOG_FORMAT(error, "Invalid thread priority %d in \"%s\" (%s)", _priority, spec.c_str(), __func__);
+        return false;
+    }
+
+    config->cpu      = _cpu < 0 ? -1 : _cpu;
+    config->policy   = _policy;
+    config->priority = _policy != SCHED_OTHER ? _priority : 0;
+    return true;
+}
+
+bool GThread::IsRealTime(const thread_config_t& config) {
+    return config.policy == SCHED_FIFO || config.policy == SCHED_RR;
+}
+
+bool GThread::Configure(const thread_config_t& config) {
+    auto _thread{pthread_self()};
+    auto _result{true};
+
+    if (!config.name.empty()) {
+        auto _name{config.name.substr(0, 15)};
+        auto _error{pthread_setname_np(_thread, _name.c_str())};
+
+        if (_error != 0) {
+            LOG_FORMAT(warning, "Unable to name thread \"%s\": %s (%s)", _name.c_str(), strerror(_error), __func__);
+            _result = false;
+        }
+    }
+
+    if (config.cpu >= 0) {
+        cpu_set_t _set;
+        CPU_ZERO(&_set);
+        CPU_SET(static_cast<size_t>(config.cpu), &_set);
+
+        auto _error{pthread_setaffinity_np(_thread, sizeof(_set), &_set)};
+
+        if (_error != 0) {
+            LOG_FORMAT(warning, "Unable to pin thread \"%s\" to cpu %d: %s (%s)", config.name.c_str(), config.cpu, strerror(_error), __func__);
+            _result = false;
+        }
+    }
+
+    if (IsRealTime(config)) {
+        sched_param _param{};
+        _param.sched_priority = config.priority;
+
+        auto _error{pthread_setschedparam(_thread, config.policy, &_param)};
+
+        if (_error != 0) {
+            LOG_FORMAT(warning, "Unable to set thread \"%s\" priority %d: %s (%s)", config.name.c_str(), config.priority, strerror(_error), __func__);
+            _result = false;
+        }
+    }
+
+    LOG_IF(_result, debug, "Thread \"%s\" configured [cpu: %d, policy: %d, priority: %d] (%s)", config.name.c_str(), config.cpu, config.policy, config.priority, __func__);
+    return _result;
+}
+
+bool GThread::CheckPrivileges(const std::vector<thread_config_t>& configs) {
+    auto _cpus{sysconf(_SC_NPROCESSORS_CONF)};
+    auto _result{true};
+
+    rlimit _limit{};
+    getrlimit(RLIMIT_RTPRIO, &_limit);
+
+    const auto _privileged{geteuid() == 0 || __has_cap_sys_nice()};
+
+    for (const auto& _config : configs) {
+        if (_config.cpu >= _cpus) {
+            LOG_FORMAT(warning, "Thread \"%s\" pinned to cpu %d, only %ld present (%s)", _config.name.c_str(), _config.cpu, _cpus, __func__);
+            _result = false;
+        }
+
+        // NOTE: RLIMIT_RTPRIO lets an unprivileged process raise its priority up to the limit
+        if (IsRealTime(_config) && !_privileged && (_limit.rlim_cur == 0 || static_cast<rlim_t>(_config.priority) > _limit.rlim_cur)) {
+            LOG_FORMAT(warning, "Thread \"%s\" priority %d needs CAP_SYS_NICE or RLIMIT_RTPRIO >= %d (%s)", _config.name.c_str(), _config.priority, _config.priority, __func__);
+            _result = false;
+        }
+    }
+
+    return _result;
+}
@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GThread.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GTHREAD_HPP
+#define GTHREAD_HPP
+
+#include <string> // string
+#include <vector> // vector
+
+// Per-thread scheduling: name, core affinity and real-time policy.
+//
+// spec: "cpu[,policy[,priority]]", e.g. "2,fifo,80", "1", "-1,rr,10", ""
+//       cpu -1 (or empty) keeps the inherited affinity
+//       policy "other" (default), "fifo" (SCHED_FIFO) or "rr" (SCHED_RR), any case
+
+typedef struct thread_config {
+    std::string name;        // NOTE: at most 15 characters are kept
+    int         cpu{-1};     // NOTE: -1 for any core
+    int         policy{0};   // NOTE: SCHED_OTHER, SCHED_FIFO or SCHED_RR
+    int         priority{0}; // NOTE: 1..99 for SCHED_FIFO and SCHED_RR
+} thread_config_t;
+
+class GThread {
+  public:
+    // NOTE: false on a malformed spec (the config is left untouched)
+    static bool Parse(const std::string& spec, thread_config_t* config);
+
+    // NOTE: applies the config to the calling thread, every failure is logged
+    static bool Configure(const thread_config_t& config);
+
+    // NOTE: warns about the configs the process is not allowed to apply
+    static bool CheckPrivileges(const std::vector<thread_config_t>& configs);
+
+    [[nodiscard]] static bool IsRealTime(const thread_config_t& config);
+};
+
+#endif // GTHREAD_HPP
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GWait.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GWAIT_HPP
+#define GWAIT_HPP
+
+#include <atomic>        // atomic
+#include <cerrno>        // errno, ERANGE, ETIMEDOUT
+#include <chrono>        // steady_clock
+#include <climits>       // INT_MAX, UINT_MAX
+#include <cstdint>       // uint32_t
+#include <cstdio>        // sscanf
+#include <cstdlib>       // strtoul
+#include <cstring>       // strcmp, strlen
+#include <linux/futex.h> // FUTEX_BITSET_MATCH_ANY, FUTEX_WAIT_BITSET_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <string>        // string
+#include <sys/syscall.h> // SYS_futex
+#include <unistd.h>      // syscall
+
+// Wait strategies on an atomic value (the futex word of std::atomic::wait):
+//
+// WAIT_BLOCKING  : parks at once, the core is released to other threads
+// WAIT_SPIN_PARK : spins up to 'spins' times, then parks
+// WAIT_BUSY_SPIN : never parks, for threads pinned to an isolated core
+//
+// spec: "blocking" (or ""), "spin[:spins]", "busy" (only "spin" takes a count)
+
+typedef enum { WAIT_BLOCKING, WAIT_SPIN_PARK, WAIT_BUSY_SPIN } wait_mode_t;
+
+typedef struct wait_strategy {
+    wait_mode_t mode{WAIT_BLOCKING};
+    unsigned    spins{4096};
+} wait_strategy_t;
+
+class GWait {
+  public:
+    static bool Parse(const std::string& spec, wait_strategy_t* strategy) {
+        const auto* _spec{spec.c_str()};
+        const auto  _size{(int)spec.size()};
+
+        char     _name[16]{};
+        unsigned _spins{strategy->spins};
+        auto     _used{-1};
+        auto     _count{false};
+
+        // NOTE: the whole spec must be consumed, the count is digits only
+        if (!spec.empty() && !(sscanf(_spec, "%15[a-z]%n", _name, &_used) == 1 && _used == _size)) {
+            _used = -1;
+
+            if (sscanf(_spec, "%15[a-z]:%*[0-9]%n", _name, &_used) != 1 || _used != _size) {
+                return false;
+            }
+
+            errno = 0;
+
+            auto _value{strtoul(_spec + strlen(_name) + 1, nullptr, 10)};
+
+            if (errno == ERANGE || _value > UINT_MAX) {
+                return false;
+            }
+
+            _spins = (unsigned)_value;
+            _count = true;
+        }
+
+        if (spec.empty() || (strcmp(_name, "blocking") == 0 && !_count)) {
+            strategy->mode = WAIT_BLOCKING;
+        }
+        else if (strcmp(_name, "spin") == 0) {
+            strategy->mode  = WAIT_SPIN_PARK;
+            strategy->spins = _spins;
+        }
+        else if (strcmp(_name, "busy") == 0 && !_count) {
+            strategy->mode = WAIT_BUSY_SPIN;
+        }
+        else {
+            return false;
+        }
+        return true;
+    }
+
+    static inline void Relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    // NOTE: returns the first value different from 'old'
+    template <typename T> static T Wait(const std::atomic<T>& value, T old, const wait_strategy_t& strategy) {
+        T _value{value.load(std::memory_order_acquire)};
+
+        if (strategy.mode != WAIT_BLOCKING) {
+            for (unsigned i{0}; _value == old && (strategy.mode == WAIT_BUSY_SPIN || i < strategy.spins); ++i) {
+                Relax();
+                _value = value.load(std::memory_order_acquire);
+            }
+        }
+
+        while (_value == old) {
+            value.wait(old, std::memory_order_acquire);
+            _value = value.load(std::memory_order_acquire);
+        }
+        return _value;
+    }
+
+    // NOTE: a busy spinner is never parked, the syscall is skipped
+    template <typename T> static void Notify(std::atomic<T>& value, const wait_strategy_t& strategy, bool all = false) {
+        if (strategy.mode == WAIT_BUSY_SPIN) {
+            return;
+        }
+
+        if (all) {
+            value.notify_all();
+        }
+        else {
+            value.notify_one();
+        }
+    }
+
+    // NOTE: raw futex on the 32-bit word, for the waits with a deadline (a
+    // null deadline never expires). Returns false on timeout only, so the
+    // caller re-checks the word after a wakeup. Its wakers must use Wake,
+    // std::atomic::notify does not see these waiters.
+    static bool Park(const std::atomic<uint32_t>& value, uint32_t old, const std::chrono::steady_clock::time_point* deadline = nullptr) {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+        struct timespec  _abs {};
+        struct timespec* _timeout{nullptr};
+
+        if (deadline != nullptr) {
+            auto _ns{std::chrono::duration_cast<std::chrono::nanoseconds>(deadline->time_since_epoch()).count()};
+            _ns = _ns > 0 ? _ns : 0;
+
+            _abs.tv_sec  = static_cast<time_t>(_ns / 1000000000);
+            _abs.tv_nsec = static_cast<long>(_ns % 1000000000);
+            _timeout     = &_abs;
+        }
+
+        // NOTE: the steady clock is CLOCK_MONOTONIC, the bitset wait takes an absolute time
+        auto _done{syscall(SYS_futex, &value, FUTEX_WAIT_BITSET_PRIVATE, old, _timeout, nullptr, FUTEX_BITSET_MATCH_ANY)};
+
+        return _done == 0 || errno != ETIMEDOUT;
+    }
+
+    static void Wake(const std::atomic<uint32_t>& value, bool all = true) {
+        syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+    }
+};
+
+#endif // GWAIT_HPP
@@ -11,11 +11,12 @@
 #define GWORKSCOUPLER_HPP
 
 #include "GDefine.hpp"
+#include "GThread.hpp" // GThread, thread_config_t
+#include "GWait.hpp"   // GWait, wait_strategy_t
 
-#include <any>                // any
-#include <condition_variable> // condition_variable
-#include <mutex>              // defer_lock, mutex, unique_lock
-#include <thread>             // sleep_for, thread
+#include <any>    // any
+#include <atomic> // atomic
+#include <thread> // thread
 
 class GWorksCoupler {
   public:
@@ -30,40 +31,60 @@ class GWorksCoupler {
         WorkFunc master_calculus = nullptr;
         WorkFunc master_epilogue = nullptr;
 
+        thread_config_t waiter_thread; // NOTE: applied before the preamble
+        thread_config_t master_thread; // NOTE: applied before the preamble
+
+        wait_strategy_t waiter_wait;      // NOTE: how the waiter waits for the master
+        unsigned        waiter_batch = 0; // NOTE: items per wakeup at most, 0 for all the pending ones
+
     } work_func_t;
 
     GWorksCoupler(work_func_t& work_func, bool& quit, std::any& args, bool is_enabled = true) {
         RETURN_IF(!is_enabled, );
 
+        m_wait = work_func.waiter_wait;
+
         t_waiter_group = std::thread([&] {
+            GThread::Configure(work_func.waiter_thread);
             CALL(work_func.waiter_preamble, quit, args);
 
-            std::unique_lock _gate(m_mutex, std::defer_lock);
+            // NOTE: handshake, the master starts after the waiter preamble
+            m_ready = 1;
+            m_ready.notify_one();
+
+            unsigned _count{0};
+
             while (!quit && !m_close) {
-                DO_GUARD(_gate, m_event.wait(_gate, [&] { return m_count > 0; }); --m_count);
-_work_label:
+                _count = GWait::Wait(m_count, 0U, m_wait);
+
                 GOTO_IF(quit || m_close, _exit_label, );
 
-                work_func.waiter_calculus(quit, args);
+                // NOTE: the pending items are consumed with one atomic update
+                _count = work_func.waiter_batch > 0 && _count > work_func.waiter_batch ? work_func.waiter_batch : _count;
+
+                for (unsigned i{0}; i < _count; ++i) {
+                    work_func.waiter_calculus(quit, args);
 
-                DO_GUARD(_gate, DEC_IF(m_count > 0, m_count, _loop, ));
+                    GOTO_IF(quit || m_close, _exit_label, );
+                }
 
-                GOTO_IF(_loop, _work_label, );
+                m_count.fetch_sub(_count, std::memory_order_acq_rel);
             }
 _exit_label:
             CALL(work_func.waiter_epilogue, quit, args);
         });
 
-        std::this_thread::sleep_for(std::chrono::microseconds(200));
-
         t_master_group = std::thread([&] {
+            GThread::Configure(work_func.master_thread);
+
+            m_ready.wait(0, std::memory_order_acquire);
+
             CALL(work_func.master_preamble, quit, args);
 
-            std::unique_lock _gate(m_mutex, std::defer_lock);
             while (!quit && !m_close) {
                 work_func.master_calculus(quit, args);
 
-                DO(DO_GUARD(_gate, ++m_count); m_event.notify_one());
+                DO(m_count.fetch_add(1, std::memory_order_acq_rel); GWait::Notify(m_count, m_wait));
             }
 
             CALL(work_func.master_epilogue, quit, args);
@@ -74,11 +95,12 @@ _exit_label:
 
     ~GWorksCoupler() {
         Close();
-        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        Wait();
     }
 
     void Close() {
-        DO_IF(!m_close, m_close = true, m_count = 1, m_event.notify_one());
+        // NOTE: a phantom item wakes the waiter, which then sees the close
+        DO_IF(!m_close.exchange(true), m_count.fetch_add(1, std::memory_order_acq_rel), m_count.notify_one());
     }
 
     void Wait() {
@@ -90,10 +112,10 @@ _exit_label:
     std::thread t_waiter_group;
     std::thread t_master_group;
 
-    bool                    m_close{false};
-    unsigned                m_count{0};
-    std::mutex              m_mutex;
-    std::condition_variable m_event;
+    wait_strategy_t       m_wait;
+    std::atomic<bool>     m_close{false};
+    std::atomic<unsigned> m_count{0};
+    std::atomic<unsigned> m_ready{0};
 };
 
 #endif // GWORKSCOUPLER_HPP
@@ -0,0 +1,344 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      GWorksPipeline.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GWORKSPIPELINE_HPP
+#define GWORKSPIPELINE_HPP
+
+#include "GDefine.hpp" // CALL
+
+#include <any>     // any
+#include <atomic>  // atomic
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t, uint64_t
+#include <memory>  // unique_ptr
+#include <mutex>   // lock_guard, mutex
+#include <thread>  // thread
+#include <vector>  // vector
+
+// N-stage pipeline of item handles (e.g. roller arrays): a source thread
+// issues the items, every stage runs its function on them with one or more
+// worker threads, a sink takes them back in issue order.
+//
+//   source --> [queue] stage 0 (workers) --> [queue] stage 1 ... --> sink
+//
+// The stages are linked by bounded lock-free queues. An IN_ORDER stage hands
+// its items on in issue order (out-of-turn items are parked), an ANY_ORDER
+// stage as soon as they are done. The items in flight never exceed 'depth',
+// so the queues never fill and the source waits for the sink instead.
+
+template <typename T> class GWorksPipeline {
+  public:
+    typedef void (*WorkFunc)(bool& quit, std::any& args);
+    typedef bool (*ItemFunc)(T*& item, bool& quit, std::any& args);
+
+    typedef enum { IN_ORDER, ANY_ORDER } order_t;
+
+    typedef struct stage_t {
+        ItemFunc calculus = nullptr;
+        WorkFunc preamble = nullptr; // NOTE: per worker thread
+        WorkFunc epilogue = nullptr; // NOTE: per worker thread
+        unsigned workers  = 1;
+        order_t  order    = IN_ORDER;
+
+    } stage_t;
+
+    typedef struct work_func_t {
+        WorkFunc source_preamble = nullptr;
+        ItemFunc source_calculus = nullptr; // NOTE: false stops the pipeline (drained)
+        WorkFunc source_epilogue = nullptr;
+
+        ItemFunc sink_calculus = nullptr; // NOTE: in issue order, one item at a time
+
+        std::vector<stage_t> stages;
+
+    } work_func_t;
+
+    // NOTE: a false from a stage or the sink aborts the pipeline (not drained)
+    GWorksPipeline(work_func_t& work_func, bool& quit, std::any& args, size_t depth = 64, bool is_enabled = true) {
+        RETURN_IF(!is_enabled || work_func.source_calculus == nullptr, );
+
+        m_depth = depth > 0 ? depth : 1;
+
+        for (const auto& _stage : work_func.stages) {
+            m_stages.emplace_back(std::make_unique<stage_state_t>(m_depth, _stage.workers > 0 ? _stage.workers : 1));
+        }
+
+        m_stages.emplace_back(std::make_unique<stage_state_t>(m_depth, 0)); // NOTE: the sink queue
+
+        for (size_t i{0}; i < work_func.stages.size(); ++i) {
+            for (unsigned w{0}; w < m_stages[i]->workers.load(); ++w) {
+                t_stage_group.emplace_back([&, i] {
+                    CALL(work_func.stages[i].preamble, quit, args);
+                    StageWorker(work_func, i, quit, args);
+                    CALL(work_func.stages[i].epilogue, quit, args);
+                });
+            }
+        }
+
+        t_source_group = std::thread([&] {
+            CALL(work_func.source_preamble, quit, args);
+            SourceWorker(work_func, quit, args);
+            CALL(work_func.source_epilogue, quit, args);
+        });
+    }
+
+    GWorksPipeline(const GWorksPipeline& pipeline) = delete;
+
+    ~GWorksPipeline() {
+        Close();
+        Wait();
+    }
+
+    GWorksPipeline& operator=(const GWorksPipeline& pipeline) = delete;
+
+    // NOTE: no more items are issued, the ones in flight reach the sink
+    void Close() {
+        m_close = true;
+        Wake(m_event);
+
+        for (auto& _stage : m_stages) {
+            Wake(_stage->queue.wake);
+        }
+    }
+
+    void Wait() {
+        DO_IF(t_source_group.joinable(), t_source_group.join());
+
+        for (auto& _thread : t_stage_group) {
+            DO_IF(_thread.joinable(), _thread.join());
+        }
+    }
+
+    [[nodiscard]] auto issued() const {
+        return m_issued.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto sunk() const {
+        return m_sunk.load(std::memory_order_relaxed);
+    }
+
+  private:
+    typedef struct item_t {
+        T*       data;
+        uint64_t sequence;
+    } item_t;
+
+    // NOTE: bounded MPMC ring (D. Vyukov), every cell carries its own turn
+    class queue_t {
+      public:
+        queue_t(size_t capacity) {
+            size_t _size{1};
+
+            while (_size < capacity) {
+                _size <<= 1;
+            }
+
+            m_mask  = _size - 1;
+            m_cells = std::make_unique<cell_t[]>(_size);
+
+            for (size_t i{0}; i < _size; ++i) {
+                m_cells[i].turn.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool Push(const item_t& item) {
+            auto _pos{m_tail.load(std::memory_order_relaxed)};
+
+            while (true) {
+                auto& _cell{m_cells[_pos & m_mask]};
+                auto  _diff{static_cast<intptr_t>(_cell.turn.load(std::memory_order_acquire)) - static_cast<intptr_t>(_pos)};
+
+                if (_diff == 0) {
+                    if (m_tail.compare_exchange_weak(_pos, _pos + 1, std::memory_order_relaxed)) {
+                        _cell.item = item;
+                        _cell.turn.store(_pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (_diff < 0) {
+                    return false;
+                }
+                else {
+                    _pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool Pop(item_t& item) {
+            auto _pos{m_head.load(std::memory_order_relaxed)};
+
+            while (true) {
+                auto& _cell{m_cells[_pos & m_mask]};
+                auto  _diff{static_cast<intptr_t>(_cell.turn.load(std::memory_order_acquire)) - static_cast<intptr_t>(_pos + 1)};
+
+                if (_diff == 0) {
+                    if (m_head.compare_exchange_weak(_pos, _pos + 1, std::memory_order_relaxed)) {
+                        item = _cell.item;
+                        _cell.turn.store(_pos + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (_diff < 0) {
+                    return false;
+                }
+                else {
+                    _pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::atomic<uint32_t> wake{0};
+
+      private:
+        typedef struct cell_t {
+            std::atomic<size_t> turn;
+            item_t              item;
+        } cell_t;
+
+        size_t                    m_mask;
+        std::unique_ptr<cell_t[]> m_cells;
+
+        alignas(64) std::atomic<size_t> m_tail{0};
+        alignas(64) std::atomic<size_t> m_head{0};
+    };
+
+    // NOTE: 'queue' feeds the stage, 'workers' counts the running ones
+    typedef struct stage_state_t {
+        stage_state_t(size_t depth, unsigned count) : queue(depth), parked(depth), workers(count) {}
+
+        queue_t               queue;
+        std::mutex            mutex;
+        std::vector<item_t>   parked; // NOTE: a null data is a free slot
+        uint64_t              turn{0};
+        std::atomic<unsigned> workers;
+        std::atomic<bool>     upstream_done{false};
+
+    } stage_state_t;
+
+    template <typename U> static void Wake(std::atomic<U>& event) {
+        event.fetch_add(1, std::memory_order_release);
+        event.notify_all();
+    }
+
+    bool IsStopped(bool& quit) const {
+        return quit || m_abort.load(std::memory_order_relaxed);
+    }
+
+    void Abort() {
+        m_abort = true;
+        Close();
+    }
+
+    void SourceWorker(work_func_t& work_func, bool& quit, std::any& args) {
+        uint64_t _sequence{0};
+
+        while (!IsStopped(quit) && !m_close) {
+            auto _event{m_event.load(std::memory_order_acquire)};
+
+            // NOTE: back-pressure, the sink must release an item first
+            if (_sequence - m_sunk.load(std::memory_order_acquire) >= m_depth) {
+                m_event.wait(_event, std::memory_order_acquire);
+                continue;
+            }
+
+            T* _data{nullptr};
+
+            BREAK_IF(!work_func.source_calculus(_data, quit, args) || _data == nullptr, );
+
+            Handoff(work_func, 0, item_t{_data, _sequence++}, quit, args);
+            m_issued.store(_sequence, std::memory_order_relaxed);
+        }
+
+        m_stages[0]->upstream_done = true;
+        Wake(m_stages[0]->queue.wake);
+    }
+
+    void StageWorker(work_func_t& work_func, size_t index, bool& quit, std::any& args) {
+        auto& _state{*m_stages[index]};
+        auto& _stage{work_func.stages[index]};
+
+        while (!IsStopped(quit)) {
+            auto   _wake{_state.queue.wake.load(std::memory_order_acquire)};
+            auto   _done{_state.upstream_done.load(std::memory_order_acquire)};
+            item_t _item;
+
+            if (!_state.queue.Pop(_item)) {
+                // NOTE: the upstream was done before the queue was found empty, so
+                // nothing more will come (an item pushed before the done is popped)
+                BREAK_IF(_done, );
+
+                _state.queue.wake.wait(_wake, std::memory_order_acquire);
+                continue;
+            }
+
+            if (!_stage.calculus(_item.data, quit, args)) {
+                Abort();
+                break;
+            }
+
+            if (_stage.order == ANY_ORDER && index + 1 < work_func.stages.size()) {
+                Handoff(work_func, index + 1, _item, quit, args);
+                continue;
+            }
+
+            std::lock_guard<std::mutex> _lock(_state.mutex);
+
+            _state.parked[_item.sequence % m_depth] = _item;
+
+            // NOTE: the worker in turn hands on the parked run that follows
+            while (true) {
+                auto& _next{_state.parked[_state.turn % m_depth]};
+
+                BREAK_IF(_next.data == nullptr || _next.sequence != _state.turn, );
+
+                auto _ready{_next};
+                _next.data = nullptr;
+                _state.turn++;
+
+                Handoff(work_func, index + 1, _ready, quit, args);
+            }
+        }
+
+        if (_state.workers.fetch_sub(1) == 1) {
+            m_stages[index + 1]->upstream_done = true;
+            Wake(m_stages[index + 1]->queue.wake);
+        }
+    }
+
+    void Handoff(work_func_t& work_func, size_t index, const item_t& item, bool& quit, std::any& args) {
+        // NOTE: never full, the items in flight are at most 'depth'
+        if (index < work_func.stages.size()) {
+            m_stages[index]->queue.Push(item);
+            m_stages[index]->queue.wake.fetch_add(1, std::memory_order_release);
+            m_stages[index]->queue.wake.notify_one();
+            return;
+        }
+
+        auto* _data{item.data};
+
+        DO_IF(work_func.sink_calculus != nullptr && !work_func.sink_calculus(_data, quit, args), Abort());
+
+        m_sunk.fetch_add(1, std::memory_order_release);
+        Wake(m_event);
+    }
+
+    size_t m_depth{1};
+
+    std::vector<std::unique_ptr<stage_state_t>> m_stages;
+
+    std::atomic<bool>     m_close{false};
+    std::atomic<bool>     m_abort{false};
+    std::atomic<uint64_t> m_issued{0};
+    std::atomic<uint64_t> m_sunk{0};
+    std::atomic<uint32_t> m_event{0};
+
+    std::thread              t_source_group;
+    std::vector<std::thread> t_stage_group;
+};
+
+#endif // GWORKSPIPELINE_HPP
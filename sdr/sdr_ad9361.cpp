@@ -22,6 +22,7 @@
 // *****************************************************************************
 
 // STD libraries
+#include <array>
 #include <cinttypes>
 #include <climits>
 #include <cmath>
@@ -238,23 +239,26 @@ int32_t ad9361_check_cal_done(ad9361_rf_phy_t* phy, //
                               bool             done_state) {
 
     uint32_t timeout = 5000; // RFDC_CAL can take long
+    uint32_t period  = (reg == REG_CALIBRATION_CTRL) ? 1200 : 120;
+
+    // the recorder keeps the poll itself, not the reads and sleeps it is made of
+    SPI_SDR_RecordPoll(reg, mask, done_state, period);
+    SPI_SDR_RecordMute(true);
 
     do {
         uint32_t state = SPI_SDR_ReadF(phy->id_no, reg, mask);
 
         if (state == done_state) {
+            SPI_SDR_RecordMute(false);
             return 0;
         }
 
-        if (reg == REG_CALIBRATION_CTRL) {
-            STIME_uSleep(1200);
-        }
-        else {
-            STIME_uSleep(120);
-        }
+        STIME_uSleep(period);
     }
     while (timeout--);
 
+    SPI_SDR_RecordMute(false);
+
     LOG_FORMAT(warning, "Calibration timeout [reg 0x%X, mask 0x%X] (%s)", reg, mask, __func__);
 
     return -ETIMEDOUT;
@@ -313,6 +317,123 @@ rx_gain_table_name_t ad9361_gt_tableindex(uint64_t freq) {
     return _val;
 }
 
+// *****************************************************************************
+/* Packed gain table images
+
+  Summary:
+    RX gain tables and Gm sub-table packed into SPI bursts at compile time.
+
+  Description:
+    Both tables sit in an 8-register window (ADDRESS .. CONFIG) and every
+    burst is written downwards from CONFIG:
+      [0]    CONFIG      : strobes the entry loaded by the previous burst
+      [1..3] READ_DATA   : dummy writes, the write delay of the table clock
+      [4..6] WRITE_DATA  : words of the next entry
+      [7]    ADDRESS     : index of the next entry
+    The first burst starts the table clock, the last one only strobes.
+
+  Remarks:
+    The receiver select bits are OR-ed into byte [0] by the loader.
+*/
+#define TABLE_BURST_LEN 8
+
+template <size_t N>
+using table_image_t = std::array<std::array<uint8_t, TABLE_BURST_LEN>, N + 1>;
+
+template <size_t N>
+static constexpr table_image_t<N> ad9361_pack_table(const uint8_t (&words)[N][3], //
+                                                    bool reverse) {
+    table_image_t<N> image{};
+
+    for (size_t k = 0; k <= N; k++) {
+        image[k][0] = START_GAIN_TABLE_CLOCK | (k ? WRITE_GAIN_TABLE : 0);
+
+        if (k < N) {
+            image[k][4] = words[k][2];
+            image[k][5] = words[k][1];
+            image[k][6] = words[k][0];
+            image[k][7] = (uint8_t)(reverse ? N - 1 - k : k);
+        }
+    }
+    return image;
+}
+
+template <size_t N>
+static constexpr auto ad9361_pack_gain_tables(const uint8_t (&tables)[RXGAIN_TBLS_END][N][3]) {
+    std::array<table_image_t<N>, RXGAIN_TBLS_END> images{};
+
+    for (size_t band = 0; band < RXGAIN_TBLS_END; band++) {
+        images[band] = ad9361_pack_table(tables[band], false);
+    }
+    return images;
+}
+
+static constexpr auto ad9361_pack_gm_subtable() {
+    uint8_t words[ARRAY_SIZE(gm_st_gain)][3]{};
+
+    // Gain, Bias and Control words (the bias is always 0)
+    for (size_t i = 0; i < ARRAY_SIZE(gm_st_gain); i++) {
+        words[i][0] = gm_st_gain[i];
+        words[i][2] = gm_st_ctrl[i];
+    }
+    return ad9361_pack_table(words, true);
+}
+
+static constexpr auto full__gain_image = ad9361_pack_gain_tables(full__gain_table);
+static constexpr auto split_gain_image = ad9361_pack_gain_tables(split_gain_table);
+static constexpr auto gm_st_image      = ad9361_pack_gm_subtable();
+
+static_assert(REG_GAIN_TABLE_CONFIG - REG_GAIN_TABLE_ADDRESS + 1 == TABLE_BURST_LEN, "gain table window must be one burst");
+static_assert(REG_GM_SUB_TABLE_CONFIG - REG_GM_SUB_TABLE_ADDRESS + 1 == TABLE_BURST_LEN, "Gm sub-table window must be one burst");
+static_assert(WRITE_GM_SUB_TABLE == WRITE_GAIN_TABLE && START_GM_SUB_TABLE_CLOCK == START_GAIN_TABLE_CLOCK, "tables share the config layout");
+static_assert(gm_st_image[1][7] == ARRAY_SIZE(gm_st_gain) - 2, "Gm sub-table is loaded from the top address");
+
+// *****************************************************************************
+/* int32_t ad9361_load_table_image(ad9361_rf_phy_t* phy, uint32_t reg_config, const std::array<uint8_t, TABLE_BURST_LEN>* image, uint32_t bursts, uint8_t select)
+
+  Summary:
+    Stream a packed table image.
+
+  Description:
+    Returns 0 in case of success, negative error code otherwise.
+
+    @param phy The AD9361 state structure.
+    @param reg_config The table CONFIG register (top of the window).
+    @param image The packed bursts.
+    @param bursts The number of bursts (entries + 1).
+    @param select The extra CONFIG bits (receiver select).
+
+  Remarks:
+    One SPI frame per entry instead of seven single-register writes.
+*/
+static int32_t ad9361_load_table_image(ad9361_rf_phy_t*                            phy, //
+                                       uint32_t                                    reg_config,
+                                       const std::array<uint8_t, TABLE_BURST_LEN>* image,
+                                       uint32_t                                    bursts,
+                                       uint8_t                                     select) {
+
+    uint8_t _buf[TABLE_BURST_LEN];
+
+    for (decltype(bursts) k{0}; k < bursts; k++) {
+        memcpy(_buf, image[k].data(), TABLE_BURST_LEN);
+        _buf[0] |= select;
+
+        // the last burst has no entry to load
+        if (!SPI_SDR_WriteM(phy->id_no, reg_config, _buf, (k + 1 < bursts) ? TABLE_BURST_LEN : 4)) {
+            return -EIO;
+        }
+    }
+
+    // Clear Write Bit (with its dummy delay), then Stop Clock
+    uint8_t _stop[4]{(uint8_t)(START_GAIN_TABLE_CLOCK | select), 0, 0, 0};
+
+    if (!SPI_SDR_WriteM(phy->id_no, reg_config, _stop, 4) || !SPI_SDR_Write(phy->id_no, reg_config, 0)) {
+        return -EIO;
+    }
+
+    return 0;
+}
+
 // *****************************************************************************
 /* int32_t ad9361_load_gt(ad9361_rf_phy_t* phy, uint64_t freq, uint32_t dest)
 
@@ -327,15 +448,16 @@ rx_gain_table_name_t ad9361_gt_tableindex(uint64_t freq) {
     @param dest The destination [ GT_RX1, GT_RX2 ].
 
   Remarks:
-    None.
+    The reload is skipped when the chip already holds the table for 'dest'.
 */
 int32_t ad9361_load_gt(ad9361_rf_phy_t* phy, //
                        uint64_t         freq,
                        uint32_t         dest) {
 
-    const uint8_t(*tab)[3];
-    rx_gain_table_name_t band;
-    uint32_t             index_max;
+    const std::array<uint8_t, TABLE_BURST_LEN>* image;
+    rx_gain_table_name_t                        band;
+    uint32_t                                    bursts;
+    int32_t                                     _val;
 
     LOG_FORMAT(debug, "Set frequency %d (%s)", freq, __func__);
 
@@ -344,39 +466,29 @@ int32_t ad9361_load_gt(ad9361_rf_phy_t* phy, //
     LOG_FORMAT(debug, "Get frequency %d, band %d (%s)", freq, band, __func__);
 
     // check if table is present
-    if (phy->current_table == band) {
+    if ((phy->current_table == band) && ((dest & ~phy->current_table_dest) == 0)) {
         return 0;
     }
 
     SPI_SDR_WriteF(phy->id_no, REG_AGC_CONFIG_2, AGC_USE_FULL_GAIN_TABLE, !phy->pdata.split_gt);
 
     if (phy->pdata.split_gt) {
-        tab       = &split_gain_table[band][0];
-        index_max = SIZE_SPLIT_TABLE;
+        image  = split_gain_image[band].data();
+        bursts = split_gain_image[band].size();
     }
     else {
-        tab       = &full__gain_table[band][0];
-        index_max = SIZE_FULL__TABLE;
+        image  = full__gain_image[band].data();
+        bursts = full__gain_image[band].size();
     }
 
-    SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK | RECEIVER_SELECT(dest)); // Start Gain Table Clock
-
-    for (decltype(index_max) i{0}; i < index_max; i++) {
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_ADDRESS, i);                                                                // Gain Table Index
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_WRITE_DATA1, tab[i][0]);                                                    // Ext LNA, Int LNA, & Mixer Gain Word
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_WRITE_DATA2, tab[i][1]);                                                    // TIA & LPF Word
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_WRITE_DATA3, tab[i][2]);                                                    // DC Cal bit & Dig Gain Word
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK | WRITE_GAIN_TABLE | RECEIVER_SELECT(dest)); // Gain Table Index
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_READ_DATA1, 0);                                                             // Dummy Write to delay 3 ADCCLK/16 cycles
-        SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_READ_DATA1, 0);                                                             // Dummy Write to delay ~1u
+    _val = ad9361_load_table_image(phy, REG_GAIN_TABLE_CONFIG, image, bursts, RECEIVER_SELECT(dest));
+    if (_val < 0) {
+        phy->current_table = RXGAIN_TBLS_END;
+        return _val;
     }
 
-    SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK | RECEIVER_SELECT(dest)); // Clear Write Bit
-    SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_READ_DATA1, 0);                                          // Dummy Write to delay ~1u
-    SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_READ_DATA1, 0);                                          // Dummy Write to delay ~1u
-    SPI_SDR_Write(phy->id_no, REG_GAIN_TABLE_CONFIG, 0);                                              // Stop Gain Table Clock
-
-    phy->current_table = band;
+    phy->current_table      = band;
+    phy->current_table_dest = dest;
 
     return 0;
 }
@@ -450,30 +562,24 @@ int32_t ad9361_clkout_control(ad9361_rf_phy_t* phy, //
     @param phy The AD9361 state structure.
 
   Remarks:
-    None.
+    The table is constant, so it is loaded once per device setup.
 */
 int32_t ad9361_load_mixer_gm_subtable(ad9361_rf_phy_t* phy) {
 
-    int32_t i, addr;
+    int32_t _val;
 
     LOG_FORMAT(debug, "Start (%s)", __func__);
 
-    SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_CONFIG, START_GM_SUB_TABLE_CLOCK); // Start Clock
+    if (phy->gm_st_loaded) {
+        return 0;
+    }
 
-    for (i = 0, addr = ARRAY_SIZE(gm_st_ctrl); i < (int64_t)ARRAY_SIZE(gm_st_ctrl); i++) {
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_ADDRESS, --addr);                                       // Gain Table Index
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_BIAS_WRITE, 0);                                         // Bias
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_GAIN_WRITE, gm_st_gain[i]);                             // Gain
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_CTRL_WRITE, gm_st_ctrl[i]);                             // Control
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_CONFIG, WRITE_GM_SUB_TABLE | START_GM_SUB_TABLE_CLOCK); // Write Words
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_GAIN_READ, 0);                                          // Dummy Delay
-        SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_GAIN_READ, 0);                                          // Dummy Delay
+    _val = ad9361_load_table_image(phy, REG_GM_SUB_TABLE_CONFIG, gm_st_image.data(), gm_st_image.size(), 0);
+    if (_val < 0) {
+        return _val;
     }
 
-    SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_CONFIG, START_GM_SUB_TABLE_CLOCK); // Clear Write
-    SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_GAIN_READ, 0);                     // Dummy Delay
-    SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_GAIN_READ, 0);                     // Dummy Delay
-    SPI_SDR_Write(phy->id_no, REG_GM_SUB_TABLE_CONFIG, 0);                        // Stop Clock
+    phy->gm_st_loaded = true;
 
     return 0;
 }
@@ -1885,6 +1991,61 @@ int32_t ad9361_tracking_control(ad9361_rf_phy_t* phy, //
     return 0;
 }
 
+// *****************************************************************************
+/* bool clk_cache_lookup(ad9361_rf_phy_t* phy, refclk_scale_t* clk_priv, uint32_t parent_rate, uint32_t* rate)
+
+  Summary:
+    Look up a memoized clock rate.
+
+  Description:
+    Returns true if the rate of the clock was already recalculated from the
+    same parent rate and nothing invalidated it since, false otherwise.
+
+  Remarks:
+    The CLK_GET_RATE_NOCACHE flag forces every lookup to miss.
+*/
+static bool clk_cache_lookup(ad9361_rf_phy_t* phy, //
+                             refclk_scale_t*  clk_priv,
+                             uint32_t         parent_rate,
+                             uint32_t*        rate) {
+
+    clk_cache_t* entry = &phy->clk_cache[clk_priv->source];
+
+    if ((phy->flags & CLK_GET_RATE_NOCACHE) || !entry->valid || (entry->parent_rate != parent_rate)) {
+        return false;
+    }
+
+    *rate = entry->rate;
+    return true;
+}
+
+// *****************************************************************************
+/* uint32_t clk_cache_store(ad9361_rf_phy_t* phy, refclk_scale_t* clk_priv, uint32_t parent_rate, uint32_t rate)
+
+  Summary:
+    Memoize a recalculated clock rate.
+
+  Description:
+    Stores the rate together with the parent rate it was derived from and
+    returns the rate itself.
+
+  Remarks:
+    None.
+*/
+static uint32_t clk_cache_store(ad9361_rf_phy_t* phy, //
+                                refclk_scale_t*  clk_priv,
+                                uint32_t         parent_rate,
+                                uint32_t         rate) {
+
+    clk_cache_t* entry = &phy->clk_cache[clk_priv->source];
+
+    entry->valid       = true;
+    entry->parent_rate = parent_rate;
+    entry->rate        = rate;
+
+    return rate;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Functions
@@ -2000,6 +2161,40 @@ int32_t ad9361_rfpll_round_rate(uint32_t rate) {
     return rate;
 }
 
+// *****************************************************************************
+/* void clk_cache_invalidate(ad9361_rf_phy_t* phy, int32_t source)
+
+  Summary:
+    Invalidate memoized clock rates.
+
+  Description:
+    Drops the memoized rate of the selected clock, or of all the clocks if
+    'source' is negative. Must be called whenever a divider, a scaler or a
+    PLL frequency word is written outside the clock framework.
+
+  Remarks:
+    Children need no explicit invalidation: their entries are keyed by the
+    parent rate and miss as soon as it changes.
+*/
+void clk_cache_invalidate(ad9361_rf_phy_t* phy, //
+                          int32_t          source) {
+
+    int32_t i;
+
+    if (source >= NUM_AD9361_CLKS) {
+        return;
+    }
+
+    if (source >= 0) {
+        phy->clk_cache[source].valid = false;
+        return;
+    }
+
+    for (i = 0; i < NUM_AD9361_CLKS; i++) {
+        phy->clk_cache[i].valid = false;
+    }
+}
+
 // *****************************************************************************
 /* int32_t clk_set_rate(ad9361_rf_phy_t* phy, refclk_scale_t* clk_priv, uint32_t rate)
 
@@ -2017,7 +2212,6 @@ int32_t clk_set_rate(ad9361_rf_phy_t* phy, //
                      uint32_t         rate) {
 
     uint32_t source = clk_priv->source;
-    int32_t  i;
     uint32_t round_rate;
 
     if (phy->clks[source].rate != rate) {
@@ -2062,22 +2256,43 @@ int32_t clk_set_rate(ad9361_rf_phy_t* phy, //
                 break;
         }
 
-        for (i = BB_REFCLK; i < BBPLL_CLK; i++) {
-            phy->clks[i].rate = ad9361_clk_factor_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clk_refin.rate);
-        }
+        clk_recalc_rates(phy);
+    }
 
-        phy->clks[BBPLL_CLK].rate = ad9361_bbpll_recalc_rate(phy, &(phy->ref_clk_scale[BBPLL_CLK]), phy->clks[phy->ref_clk_scale[BBPLL_CLK].parent_source].rate);
+    return 0;
+}
 
-        for (i = ADC_CLK; i < RX_RFPLL; i++) {
-            phy->clks[i].rate = ad9361_clk_factor_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clks[phy->ref_clk_scale[i].parent_source].rate);
-        }
+// *****************************************************************************
+/* void clk_recalc_rates(ad9361_rf_phy_t* phy)
 
-        for (i = RX_RFPLL; i < NUM_AD9361_CLKS; i++) {
-            phy->clks[i].rate = ad9361_rfpll_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clks[phy->ref_clk_scale[i].parent_source].rate);
-        }
+  Summary:
+    Recalculate all the clock rates.
+
+  Description:
+    Refreshes the rate of every clock, parents first, from the device
+    registers or the memoized rates.
+
+  Remarks:
+    The clocks whose registers were written outside the clock framework must
+    be invalidated first (see clk_cache_invalidate).
+*/
+void clk_recalc_rates(ad9361_rf_phy_t* phy) {
+
+    int32_t i;
+
+    for (i = BB_REFCLK; i < BBPLL_CLK; i++) {
+        phy->clks[i].rate = ad9361_clk_factor_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clk_refin.rate);
     }
 
-    return 0;
+    phy->clks[BBPLL_CLK].rate = ad9361_bbpll_recalc_rate(phy, &(phy->ref_clk_scale[BBPLL_CLK]), phy->clks[phy->ref_clk_scale[BBPLL_CLK].parent_source].rate);
+
+    for (i = ADC_CLK; i < RX_RFPLL; i++) {
+        phy->clks[i].rate = ad9361_clk_factor_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clks[phy->ref_clk_scale[i].parent_source].rate);
+    }
+
+    for (i = RX_RFPLL; i < NUM_AD9361_CLKS; i++) {
+        phy->clks[i].rate = ad9361_rfpll_recalc_rate(phy, &(phy->ref_clk_scale[i]), phy->clks[phy->ref_clk_scale[i].parent_source].rate);
+    }
 }
 
 // *****************************************************************************
@@ -2386,6 +2601,7 @@ int32_t ad9361_trx_ext_lo_control(ad9361_rf_phy_t* phy, //
         SPI_SDR_WriteF(phy->id_no, REG_ENSM_CONFIG_2, POWER_DOWN_TX_SYNTH, enable);
 
         SPI_SDR_WriteF(phy->id_no, REG_RFPLL_DIVIDERS, TX_VCO_DIVIDER(~0), 0x07);
+        clk_cache_invalidate(phy, TX_RFPLL);
 
         SPI_SDR_Write(phy->id_no, REG_TX_SYNTH_POWER_DOWN_OVERRIDE, enable ? TX_SYNTH_VCO_ALC_POWER_DOWN | TX_SYNTH_PTAT_POWER_DOWN | TX_SYNTH_VCO_POWER_DOWN : 0x00);
 
@@ -2397,6 +2613,7 @@ int32_t ad9361_trx_ext_lo_control(ad9361_rf_phy_t* phy, //
         SPI_SDR_WriteF(phy->id_no, REG_ENSM_CONFIG_2, POWER_DOWN_RX_SYNTH, enable);
 
         SPI_SDR_WriteF(phy->id_no, REG_RFPLL_DIVIDERS, RX_VCO_DIVIDER(~0), 0x07);
+        clk_cache_invalidate(phy, RX_RFPLL);
 
         SPI_SDR_Write(phy->id_no, REG_RX_SYNTH_POWER_DOWN_OVERRIDE, enable ? RX_SYNTH_VCO_ALC_POWER_DOWN | RX_SYNTH_PTAT_POWER_DOWN | RX_SYNTH_VCO_POWER_DOWN : 0x00);
 
@@ -3410,8 +3627,192 @@ int32_t ad9361_set_trx_clock_chain(ad9361_rf_phy_t* phy, //
     return ad9361_bb_clk_change_handler(phy);
 }
 
+/**
+ * Solved RX and TX path rates for a sample rate and a filter configuration.
+ */
+typedef struct clock_chain {
+    uint32_t tx_sample_rate;
+    uint32_t rate_gov;
+    uint32_t rx_intdec;
+    uint32_t tx_intdec;
+    bool     rx_eq_2tx;
+    int32_t  status;
+    uint32_t adc_rate;
+    uint32_t rx_path_clks[NUM_RX_CLOCKS];
+    uint32_t tx_path_clks[NUM_TX_CLOCKS];
+
+} clock_chain_t;
+
+/**
+ * Search the divider chain that yields the desired sample rate.
+ * Note: pure function, usable both at compile time and at run time.
+ * @param tx_sample_rate The desired sample rate.
+ * @param rate_gov The rate governor option.
+ * @param rx_intdec The RX FIR decimation factor.
+ * @param tx_intdec The TX FIR interpolation factor.
+ * @param rx_eq_2tx Set true if the RX rate is twice the TX rate.
+ * @return The solved chain, with negative status if no dividers are suitable.
+ */
+static constexpr clock_chain_t ad9361_solve_rf_clock_chain(uint32_t tx_sample_rate, //
+                                                           uint32_t rate_gov,
+                                                           uint32_t rx_intdec,
+                                                           uint32_t tx_intdec,
+                                                           bool     rx_eq_2tx) {
+
+    constexpr int8_t clk_dividers[][4] = {
+        {12, 3, 2, 2},
+        {8, 2, 2, 2},
+        {6, 3, 1, 2},
+        {4, 2, 2, 1},
+        {3, 3, 1, 1},
+        {2, 2, 1, 1},
+        {1, 1, 1, 1},
+    };
+
+    clock_chain_t chain{tx_sample_rate, rate_gov, rx_intdec, tx_intdec, rx_eq_2tx, -EINVAL, 0, {}, {}};
+
+    uint32_t clktf     = tx_sample_rate * tx_intdec;
+    uint32_t clkrf     = tx_sample_rate * rx_intdec * (rx_eq_2tx ? 2 : 1);
+    uint32_t adc_rate  = 0;
+    uint32_t dac_rate  = 0;
+    uint32_t recursion = 1;
+    uint32_t div       = MAX_BBPLL_DIV;
+    uint64_t bbpll_rate{0};
+    int32_t  i, index_rx, index_tx, tmp;
+
+    while (true) {
+        adc_rate = 0;
+        dac_rate = 0;
+        index_rx = -1;
+        index_tx = -1;
+
+        if ((rate_gov == 1) && ((rx_intdec * tx_sample_rate * 8) < MIN_ADC_CLK)) {
+            recursion = 0;
+            rate_gov  = 0;
+        }
+
+        for (i = rate_gov; i < 7; i++) {
+            adc_rate = clkrf * clk_dividers[i][0];
+            dac_rate = clktf * clk_dividers[i][0];
+
+            if ((adc_rate <= MAX_ADC_CLK) && (adc_rate >= MIN_ADC_CLK)) {
+                if (dac_rate > adc_rate) {
+                    tmp = -(int32_t)(dac_rate / adc_rate);
+                }
+                else {
+                    tmp = adc_rate / dac_rate;
+                }
+
+                if (adc_rate <= MAX_DAC_CLK) {
+                    index_rx = i;
+                    index_tx = i - ((tmp == 1) ? 0 : tmp);
+
+                    dac_rate = adc_rate; // ADC_CLK
+                    break;
+                }
+                else {
+                    dac_rate = adc_rate / 2; // ADC_CLK/2
+
+                    index_rx = i;
+
+                    if ((i == 4) && (tmp >= 0)) {
+                        index_tx = 7; // STOP: 3/2 != 1
+                    }
+                    else {
+                        index_tx = i + (((i == 5) && (tmp >= 0)) ? 1 : 2) - ((tmp == 1) ? 0 : tmp);
+                    }
+                    break;
+                }
+            }
+        }
+
+        if ((index_tx >= 0) && (index_tx <= 6) && (index_rx >= 0) && (index_rx <= 6)) {
+            break;
+        }
+
+        if ((rate_gov < 7) && recursion) {
+            rate_gov++;
+            continue;
+        }
+
+        chain.adc_rate = adc_rate;
+        return chain;
+    }
+
+    // Calculate target BBPLL rate
+    do {
+        bbpll_rate = (uint64_t)adc_rate * div;
+        div >>= 1;
+    }
+    while ((bbpll_rate > MAX_BBPLL_FREQ) && (div >= MIN_BBPLL_DIV));
+
+    chain.status   = 0;
+    chain.adc_rate = adc_rate;
+
+    chain.rx_path_clks[BBPLL_FREQ]    = bbpll_rate;
+    chain.rx_path_clks[ADC_FREQ]      = adc_rate;
+    chain.rx_path_clks[R2_FREQ]       = chain.rx_path_clks[ADC_FREQ] / clk_dividers[index_rx][1];
+    chain.rx_path_clks[R1_FREQ]       = chain.rx_path_clks[R2_FREQ] / clk_dividers[index_rx][2];
+    chain.rx_path_clks[CLKRF_FREQ]    = chain.rx_path_clks[R1_FREQ] / clk_dividers[index_rx][3];
+    chain.rx_path_clks[RX_SAMPL_FREQ] = chain.rx_path_clks[CLKRF_FREQ] / rx_intdec;
+
+    chain.tx_path_clks[BBPLL_FREQ]    = bbpll_rate;
+    chain.tx_path_clks[DAC_FREQ]      = dac_rate;
+    chain.tx_path_clks[T2_FREQ]       = chain.tx_path_clks[DAC_FREQ] / clk_dividers[index_tx][1];
+    chain.tx_path_clks[T1_FREQ]       = chain.tx_path_clks[T2_FREQ] / clk_dividers[index_tx][2];
+    chain.tx_path_clks[CLKTF_FREQ]    = chain.tx_path_clks[T1_FREQ] / clk_dividers[index_tx][3];
+    chain.tx_path_clks[TX_SAMPL_FREQ] = chain.tx_path_clks[CLKTF_FREQ] / tx_intdec;
+
+    return chain;
+}
+
+// LTE sample rates, solved at compile time for both rate governor options
+static constexpr uint32_t clock_chain_rates[]  = {1920000, 3840000, 7680000, 15360000, 30720000, 61440000};
+static constexpr uint32_t clock_chain_intdec[] = {1, 2, 4};
+
+static constexpr auto clock_chain_table = [] {
+    std::array<clock_chain_t, ARRAY_SIZE(clock_chain_rates) * ARRAY_SIZE(clock_chain_intdec) * 2> table{};
+
+    size_t n = 0;
+
+    for (auto rate : clock_chain_rates) {
+        for (auto intdec : clock_chain_intdec) {
+            for (uint32_t gov = 0; gov < 2; gov++) {
+                table[n++] = ad9361_solve_rf_clock_chain(rate, gov, intdec, intdec, false);
+            }
+        }
+    }
+    return table;
+}();
+
+static_assert(clock_chain_table[4 * 6 + 1].rx_path_clks[BBPLL_FREQ] == 983040000UL, "30.72 MSPS must run the BBPLL at 983.04 MHz");
+
+/**
+ * Look up a solved chain in the compile time table.
+ * @return The solved chain if present, nullptr otherwise.
+ */
+static const clock_chain_t* ad9361_find_rf_clock_chain(uint32_t tx_sample_rate, //
+                                                       uint32_t rate_gov,
+                                                       uint32_t rx_intdec,
+                                                       uint32_t tx_intdec,
+                                                       bool     rx_eq_2tx) {
+
+    for (const auto& chain : clock_chain_table) {
+        if ((chain.tx_sample_rate == tx_sample_rate) && //
+            (chain.rate_gov == rate_gov) &&
+            (chain.rx_intdec == rx_intdec) &&
+            (chain.tx_intdec == tx_intdec) &&
+            (chain.rx_eq_2tx == rx_eq_2tx)) {
+            return &chain;
+        }
+    }
+
+    return nullptr;
+}
+
 /**
  * Calculate the RX and TX path rates to obtain the desired sample rate.
+ * Note: common sample rates are served from a table solved at compile time.
  * @param phy The AD9361 state structure.
  * @param tx_sample_rate The desired sample rate.
  * @param rate_gov The rate governor option.
@@ -3425,20 +3826,9 @@ int32_t ad9361_calculate_rf_clock_chain(ad9361_rf_phy_t* phy, //
                                         uint32_t*        rx_path_clks,
                                         uint32_t*        tx_path_clks) {
 
-    uint32_t clktf, clkrf, adc_rate = 0, dac_rate = 0;
-    uint64_t bbpll_rate;
-    int32_t  i, index_rx = -1, index_tx = -1, tmp;
-    uint32_t div, tx_intdec, rx_intdec, recursion = 1;
-
-    const int8_t clk_dividers[][4] = {
-        {12, 3, 2, 2},
-        {8, 2, 2, 2},
-        {6, 3, 1, 2},
-        {4, 2, 2, 1},
-        {3, 3, 1, 1},
-        {2, 2, 1, 1},
-        {1, 1, 1, 1},
-    };
+    const clock_chain_t* chain;
+    clock_chain_t        solved;
+    uint32_t             tx_intdec, rx_intdec;
 
     if (phy->bypass_rx_fir) {
         rx_intdec = 1;
@@ -3454,11 +3844,6 @@ int32_t ad9361_calculate_rf_clock_chain(ad9361_rf_phy_t* phy, //
         tx_intdec = phy->tx_fir_int;
     }
 
-    if ((rate_gov == 1) && ((rx_intdec * tx_sample_rate * 8) < MIN_ADC_CLK)) {
-        recursion = 0;
-        rate_gov  = 0;
-    }
-
     LOG_FORMAT(debug,
                "Requested rate %" PRIu32 ", TXFIR int %" PRIu32 ", RXFIR dec %" PRIu32 ", mode %s (%s)", //
                tx_sample_rate,
@@ -3471,77 +3856,23 @@ int32_t ad9361_calculate_rf_clock_chain(ad9361_rf_phy_t* phy, //
         return -EINVAL;
     }
 
-    clktf = tx_sample_rate * tx_intdec;
-    clkrf = tx_sample_rate * rx_intdec * (phy->rx_eq_2tx ? 2 : 1);
-
-    for (i = rate_gov; i < 7; i++) {
-        adc_rate = clkrf * clk_dividers[i][0];
-        dac_rate = clktf * clk_dividers[i][0];
-
-        if ((adc_rate <= MAX_ADC_CLK) && (adc_rate >= MIN_ADC_CLK)) {
-            if (dac_rate > adc_rate) {
-                tmp = (dac_rate / adc_rate) * -1;
-            }
-            else {
-                tmp = adc_rate / dac_rate;
-            }
-
-            if (adc_rate <= MAX_DAC_CLK) {
-                index_rx = i;
-                index_tx = i - ((tmp == 1) ? 0 : tmp);
+    chain = ad9361_find_rf_clock_chain(tx_sample_rate, rate_gov, rx_intdec, tx_intdec, phy->rx_eq_2tx);
 
-                dac_rate = adc_rate; // ADC_CLK
-                break;
-            }
-            else {
-                dac_rate = adc_rate / 2; // ADC_CLK/2
-
-                index_rx = i;
-
-                if ((i == 4) && (tmp >= 0)) {
-                    index_tx = 7; // STOP: 3/2 != 1
-                }
-                else {
-                    index_tx = i + (((i == 5) && (tmp >= 0)) ? 1 : 2) - ((tmp == 1) ? 0 : tmp);
-                }
-                break;
-            }
-        }
+    if (chain == nullptr) {
+        solved = ad9361_solve_rf_clock_chain(tx_sample_rate, rate_gov, rx_intdec, tx_intdec, phy->rx_eq_2tx);
+        chain  = &solved;
     }
 
-    if (((index_tx < 0) || (index_tx > 6) || (index_rx < 0) || (index_rx > 6)) && (rate_gov < 7) && recursion) {
-        return ad9361_calculate_rf_clock_chain(phy, tx_sample_rate, ++rate_gov, rx_path_clks, tx_path_clks);
-    }
-    else if (((index_tx < 0) || (index_tx > 6) || (index_rx < 0) || (index_rx > 6))) {
+    if (chain->status < 0) {
         LOG_FORMAT(error,
                    "Failed to find suitable dividers %s (%s)", //
-                   (adc_rate < MIN_ADC_CLK) ? "ADC clock below limit" : "BBPLL rate above limit",
+                   (chain->adc_rate < MIN_ADC_CLK) ? "ADC clock below limit" : "BBPLL rate above limit",
                    __func__);
-        return -EINVAL;
+        return chain->status;
     }
 
-    // Calculate target BBPLL rate
-    div = MAX_BBPLL_DIV;
-
-    do {
-        bbpll_rate = (uint64_t)adc_rate * div;
-        div >>= 1;
-    }
-    while ((bbpll_rate > MAX_BBPLL_FREQ) && (div >= MIN_BBPLL_DIV));
-
-    rx_path_clks[BBPLL_FREQ]    = bbpll_rate;
-    rx_path_clks[ADC_FREQ]      = adc_rate;
-    rx_path_clks[R2_FREQ]       = rx_path_clks[ADC_FREQ] / clk_dividers[index_rx][1];
-    rx_path_clks[R1_FREQ]       = rx_path_clks[R2_FREQ] / clk_dividers[index_rx][2];
-    rx_path_clks[CLKRF_FREQ]    = rx_path_clks[R1_FREQ] / clk_dividers[index_rx][3];
-    rx_path_clks[RX_SAMPL_FREQ] = rx_path_clks[CLKRF_FREQ] / rx_intdec;
-
-    tx_path_clks[BBPLL_FREQ]    = bbpll_rate;
-    tx_path_clks[DAC_FREQ]      = dac_rate;
-    tx_path_clks[T2_FREQ]       = tx_path_clks[DAC_FREQ] / clk_dividers[index_tx][1];
-    tx_path_clks[T1_FREQ]       = tx_path_clks[T2_FREQ] / clk_dividers[index_tx][2];
-    tx_path_clks[CLKTF_FREQ]    = tx_path_clks[T1_FREQ] / clk_dividers[index_tx][3];
-    tx_path_clks[TX_SAMPL_FREQ] = tx_path_clks[CLKTF_FREQ] / tx_intdec;
+    memcpy(rx_path_clks, chain->rx_path_clks, sizeof(chain->rx_path_clks));
+    memcpy(tx_path_clks, chain->tx_path_clks, sizeof(chain->tx_path_clks));
 
     return 0;
 }
@@ -3679,6 +4010,8 @@ int32_t ad9361_fastlock_prepare(ad9361_rf_phy_t* phy, //
         SPI_SDR_WriteF(phy->id_no, REG_ENSM_CONFIG_2, ready_mask, 0);
 
         phy->fastlock.current_profile[tx] = 0;
+
+        clk_cache_invalidate(phy, tx ? TX_RFPLL : RX_RFPLL);
     }
 
     return 0;
@@ -4025,8 +4358,41 @@ int32_t ad9361_do_calib_run(ad9361_rf_phy_t* phy, //
     return _val;
 }
 
+#define FIR_BURST_LEN     6 // COEF_ADDR .. CONF window
+#define FIR_VERIFY_STRIDE 8 // sampled verification: one tap out of 8
+
+static_assert(REG_TX_FILTER_CONF - REG_TX_FILTER_COEF_ADDR + 1 == FIR_BURST_LEN, "FIR window must be one burst");
+static_assert(REG_RX_FILTER_CONFIG - REG_RX_FILTER_COEF_ADDR + 1 == FIR_BURST_LEN, "FIR window must be one burst");
+
+/**
+ * Read back one FIR filter tap.
+ * Note: the address write and the two data bytes take two SPI frames.
+ * @param phy The AD9361 state structure.
+ * @param offs The RX/TX register offset.
+ * @param tap The tap index.
+ * @param coef Pointer to the read coefficient.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t ad9361_read_fir_tap(ad9361_rf_phy_t* phy, //
+                                   uint32_t         offs,
+                                   uint32_t         tap,
+                                   int16_t*         coef) {
+
+    uint8_t _buf[2]; // READ_DATA_2, READ_DATA_1
+
+    if (!SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_ADDR + offs, tap) || //
+        !SPI_SDR_ReadM(phy->id_no, REG_TX_FILTER_COEF_READ_DATA_2 + offs, _buf, 2)) {
+        return -EIO;
+    }
+
+    *coef = (int16_t)(_buf[1] | (_buf[0] << 8));
+
+    return 0;
+}
+
 /**
  * Verify the FIR filter coefficients.
+ * Note: the mode is selected by 'pdata.fir_verify', a failing channel loses its shadow.
  * @param phy The AD9361 state structure.
  * @param dest Destination identifier (RX1,2 / TX1,2).
  * @param ntaps Number of filter Taps.
@@ -4038,10 +4404,16 @@ int32_t ad9361_verify_fir_filter_coef(ad9361_rf_phy_t* phy, //
                                       uint32_t         ntaps,
                                       short*           coef) {
 
-    uint32_t val, offs = 0, gain = 0, conf, sel, cnt;
+    uint32_t val, offs = 0, gain = 0, conf, sel, cnt, step;
     int32_t  _val = 0;
 
-    LOG_FORMAT(debug, "TAPS %" PRIu32 ", destination %d (%s)", ntaps, dest, __func__);
+    LOG_FORMAT(debug, "TAPS %" PRIu32 ", destination %d, mode %d (%s)", ntaps, dest, phy->pdata.fir_verify, __func__);
+
+    if (phy->pdata.fir_verify == FIR_VERIFY_OFF) {
+        return 0;
+    }
+
+    step = (phy->pdata.fir_verify == FIR_VERIFY_SAMPLED) ? FIR_VERIFY_STRIDE : 1;
 
     if (dest & FIR_IS_RX) {
         gain = SPI_SDR_Read(phy->id_no, REG_RX_FILTER_GAIN);
@@ -4061,16 +4433,27 @@ int32_t ad9361_verify_fir_filter_coef(ad9361_rf_phy_t* phy, //
     }
 
     for (; cnt > 0; cnt--, sel++) {
+        uint32_t sum_read = 0, sum_coef = 0;
+
         SPI_SDR_Write(phy->id_no, REG_TX_FILTER_CONF + offs, FIR_NUM_TAPS(ntaps / 16 - 1) | FIR_SELECT(sel) | FIR_START_CLK);
 
         for (val = 0; val < ntaps; val++) {
-            short tmp;
+            int16_t tmp = 0;
 
-            SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_ADDR + offs, val);
+            // the last tap is always part of the sample
+            if ((val % step) && (val != ntaps - 1)) {
+                continue;
+            }
 
-            tmp = (SPI_SDR_Read(phy->id_no, REG_TX_FILTER_COEF_READ_DATA_1 + offs) & 0xFF) | (SPI_SDR_Read(phy->id_no, REG_TX_FILTER_COEF_READ_DATA_2 + offs) << 8);
+            if (ad9361_read_fir_tap(phy, offs, val, &tmp) < 0) {
+                _val = -EIO;
+            }
 
-            if (tmp != coef[val]) {
+            if (step > 1) {
+                sum_read = ((sum_read << 1) | (sum_read >> 31)) ^ (uint16_t)tmp;
+                sum_coef = ((sum_coef << 1) | (sum_coef >> 31)) ^ (uint16_t)coef[val];
+            }
+            else if (tmp != coef[val]) {
                 LOG_FORMAT(error,
                            "%s%" PRIu32 " read verify failed TAP%" PRIu32 " %d =! %d (%s)", //
                            (dest & FIR_IS_RX) ? "RX" : "TX",
@@ -4082,6 +4465,21 @@ int32_t ad9361_verify_fir_filter_coef(ad9361_rf_phy_t* phy, //
                 _val = -EIO;
             }
         }
+
+        if (sum_read != sum_coef) {
+            LOG_FORMAT(error,
+                       "%s%" PRIu32 " read verify failed checksum 0x%08" PRIX32 " =! 0x%08" PRIX32 " (%s)", //
+                       (dest & FIR_IS_RX) ? "RX" : "TX",
+                       sel,
+                       sum_read,
+                       sum_coef,
+                       __func__);
+            _val = -EIO;
+        }
+
+        if (_val < 0) {
+            phy->fir_shadow[(dest & FIR_IS_RX) ? 1 : 0].ntaps[sel - 1] = 0;
+        }
     }
 
     if (dest & FIR_IS_RX) {
@@ -4095,6 +4493,7 @@ int32_t ad9361_verify_fir_filter_coef(ad9361_rf_phy_t* phy, //
 
 /**
  * Load the FIR filter coefficients.
+ * Note: one burst per tap, taps already holding the value are skipped.
  * @param phy The AD9361 state structure.
  * @param dest Destination identifier (RX1,2 / TX1,2).
  * @param gain_dB Gain option.
@@ -4108,7 +4507,9 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
                                     uint32_t         ntaps,
                                     int16_t*         coef) {
 
-    uint32_t val, offs = 0, fir_conf = 0, fir_enable = 0;
+    uint32_t val, offs = 0, fir_conf = 0, fir_enable = 0, skipped = 0;
+    uint8_t  _buf[FIR_BURST_LEN];
+    bool     pending = false;
 
     LOG_FORMAT(debug,
                "TAPS %" PRIu32 ", gain %" PRId32 ", destination %d (%s)", //
@@ -4127,6 +4528,8 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
         return -EINVAL;
     }
 
+    fir_shadow_t* shadow = &phy->fir_shadow[(dest & FIR_IS_RX) ? 1 : 0];
+
     if (dest & FIR_IS_RX) {
         val = 3 - (gain_dB + 12) / 6;
 
@@ -4139,6 +4542,7 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
         fir_enable = SPI_SDR_ReadF(phy->id_no, REG_RX_ENABLE_FILTER_CTRL, RX_FIR_ENABLE_DECIMATION(~0));
 
         SPI_SDR_WriteF(phy->id_no, REG_RX_ENABLE_FILTER_CTRL, RX_FIR_ENABLE_DECIMATION(~0), (phy->rx_fir_dec == 4) ? 3 : phy->rx_fir_dec);
+        clk_cache_invalidate(phy, RX_SAMPL_CLK);
     }
     else {
         if (gain_dB == -6) {
@@ -4150,6 +4554,7 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
         fir_enable = SPI_SDR_ReadF(phy->id_no, REG_TX_ENABLE_FILTER_CTRL, TX_FIR_ENABLE_INTERPOLATION(~0));
 
         SPI_SDR_WriteF(phy->id_no, REG_TX_ENABLE_FILTER_CTRL, TX_FIR_ENABLE_INTERPOLATION(~0), (phy->tx_fir_int == 4) ? 3 : phy->tx_fir_int);
+        clk_cache_invalidate(phy, TX_SAMPL_CLK);
     }
 
     val = ntaps / 16 - 1;
@@ -4158,13 +4563,39 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
 
     SPI_SDR_Write(phy->id_no, REG_TX_FILTER_CONF + offs, fir_conf);
 
+    // Each burst is written downwards from CONF: it strobes the tap loaded by the
+    // previous burst, writes two dummy READ_DATA (write delay), then loads the next tap.
     for (val = 0; val < ntaps; val++) {
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_ADDR + offs, val);
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_WRITE_DATA_1 + offs, (coef[val] & 0xFF));
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_WRITE_DATA_2 + offs, (coef[val] >> 8));
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_CONF + offs, fir_conf | FIR_WRITE);
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
-        SPI_SDR_Write(phy->id_no, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+        bool unchanged = true;
+
+        for (uint32_t ch = 0; ch < 2; ch++) {
+            if ((dest & (1 << ch)) && ((val >= shadow->ntaps[ch]) || (shadow->coef[ch][val] != coef[val]))) {
+                unchanged = false;
+            }
+        }
+
+        if (unchanged) {
+            skipped++;
+            continue;
+        }
+
+        _buf[0] = fir_conf | (pending ? FIR_WRITE : 0);
+        _buf[1] = 0;
+        _buf[2] = 0;
+        _buf[3] = coef[val] >> 8;
+        _buf[4] = coef[val] & 0xFF;
+        _buf[5] = val;
+
+        SPI_SDR_WriteM(phy->id_no, REG_TX_FILTER_CONF + offs, _buf, FIR_BURST_LEN);
+        pending = true;
+    }
+
+    if (pending) {
+        _buf[0] = fir_conf | FIR_WRITE;
+        _buf[1] = 0;
+        _buf[2] = 0;
+
+        SPI_SDR_WriteM(phy->id_no, REG_TX_FILTER_CONF + offs, _buf, 3);
     }
 
     SPI_SDR_Write(phy->id_no, REG_TX_FILTER_CONF + offs, fir_conf);
@@ -4175,11 +4606,22 @@ int32_t ad9361_load_fir_filter_coef(ad9361_rf_phy_t* phy, //
 
     if (dest & FIR_IS_RX) {
         SPI_SDR_WriteF(phy->id_no, REG_RX_ENABLE_FILTER_CTRL, RX_FIR_ENABLE_DECIMATION(~0), fir_enable);
+        clk_cache_invalidate(phy, RX_SAMPL_CLK);
     }
     else {
         SPI_SDR_WriteF(phy->id_no, REG_TX_ENABLE_FILTER_CTRL, TX_FIR_ENABLE_INTERPOLATION(~0), fir_enable);
+        clk_cache_invalidate(phy, TX_SAMPL_CLK);
     }
 
+    for (uint32_t ch = 0; ch < 2; ch++) {
+        if (dest & (1 << ch)) {
+            memcpy(shadow->coef[ch], coef, ntaps * sizeof(int16_t));
+            shadow->ntaps[ch] = max_t(uint32_t, shadow->ntaps[ch], ntaps);
+        }
+    }
+
+    LOG_FORMAT(debug, "TAPS %" PRIu32 ", skipped %" PRIu32 " (%s)", ntaps, skipped, __func__);
+
     return ad9361_verify_fir_filter_coef(phy, dest, ntaps, coef);
 }
 
@@ -4355,6 +4797,10 @@ int32_t ad9361_set_clk_scaler(ad9361_rf_phy_t* phy, //
     uint32_t tmp;
     int32_t  _val;
 
+    if (set) {
+        clk_cache_invalidate(phy, clk_priv->source);
+    }
+
     switch (clk_priv->source) {
         case BB_REFCLK:
             _val = ad9361_to_refclk_scaler(clk_priv);
@@ -4539,10 +4985,16 @@ uint32_t ad9361_clk_factor_recalc_rate(ad9361_rf_phy_t* phy, //
                                        refclk_scale_t*  clk_priv,
                                        uint32_t         parent_rate) {
 
+    uint32_t cached;
+
+    if (clk_cache_lookup(phy, clk_priv, parent_rate, &cached)) {
+        return cached;
+    }
+
     ad9361_get_clk_scaler(phy, clk_priv);
 
     uint64_t rate = (parent_rate * clk_priv->mult) / clk_priv->div;
-    return (uint32_t)rate;
+    return clk_cache_store(phy, clk_priv, parent_rate, (uint32_t)rate);
 }
 
 /**
@@ -4623,12 +5075,14 @@ uint32_t ad9361_bbpll_recalc_rate(ad9361_rf_phy_t* phy, //
                                   refclk_scale_t*  clk_priv,
                                   uint32_t         parent_rate) {
 
-    UNUSED(clk_priv)
-
     uint64_t rate;
-    uint32_t fract, integer;
+    uint32_t fract, integer, cached;
     uint8_t  buf[4];
 
+    if (clk_cache_lookup(phy, clk_priv, parent_rate, &cached)) {
+        return cached;
+    }
+
     SPI_SDR_ReadM(phy->id_no, REG_INTEGER_BB_FREQ_WORD, &buf[0], REG_INTEGER_BB_FREQ_WORD - REG_FRACT_BB_FREQ_WORD_1 + 1);
 
     fract   = (buf[3] << 16) | (buf[2] << 8) | buf[1];
@@ -4638,7 +5092,7 @@ uint32_t ad9361_bbpll_recalc_rate(ad9361_rf_phy_t* phy, //
     int_do_div(&rate, BBPLL_MODULUS);
     rate += ((uint64_t)parent_rate * integer);
 
-    return (uint32_t)rate;
+    return clk_cache_store(phy, clk_priv, parent_rate, (uint32_t)rate);
 }
 
 /**
@@ -4653,8 +5107,6 @@ int32_t ad9361_bbpll_set_rate(ad9361_rf_phy_t* phy, //
                               uint32_t         rate,
                               uint32_t         parent_rate) {
 
-    UNUSED(clk_priv);
-
     uint32_t fract, integer;
     int32_t  icp_val;
     uint8_t  lf_defaults[3] = {0x35, 0x5B, 0xE8};
@@ -4662,6 +5114,8 @@ int32_t ad9361_bbpll_set_rate(ad9361_rf_phy_t* phy, //
 
     LOG_FORMAT(debug, "Rate %" PRIu32 " Hz, Parent Rate %" PRIu32 " Hz (%s)", rate, parent_rate, __func__);
 
+    clk_cache_invalidate(phy, clk_priv->source);
+
     // Setup Loop Filter and CP Current
     // Scale is 150uA @ (1280MHz BBPLL, 40MHz REFCLK)
     tmp_1 = (rate >> 7) * 150ULL;
@@ -4783,10 +5237,14 @@ uint32_t ad9361_rfpll_recalc_rate(ad9361_rf_phy_t* phy, //
                                   refclk_scale_t*  clk_priv,
                                   uint32_t         parent_rate) {
 
-    uint32_t fract, integer;
+    uint32_t fract, integer, cached;
     uint8_t  buf[5];
     uint32_t reg, div_mask, vco_div, profile;
 
+    if (clk_cache_lookup(phy, clk_priv, parent_rate, &cached)) {
+        return cached;
+    }
+
     LOG_FORMAT(debug, "Parent rate %" PRIu32 " Hz (%s)", parent_rate, __func__);
 
     switch (clk_priv->source) {
@@ -4826,7 +5284,7 @@ uint32_t ad9361_rfpll_recalc_rate(ad9361_rf_phy_t* phy, //
     fract   = (SYNTH_FRACT_WORD(buf[0]) << 16) | (buf[1] << 8) | buf[2];
     integer = (SYNTH_INTEGER_WORD(buf[3]) << 8) | buf[4];
 
-    return ad9361_to_clk(ad9361_calc_rfpll_freq(parent_rate, integer, fract, vco_div));
+    return clk_cache_store(phy, clk_priv, parent_rate, ad9361_to_clk(ad9361_calc_rfpll_freq(parent_rate, integer, fract, vco_div)));
 }
 
 /**
@@ -4889,6 +5347,8 @@ int32_t ad9361_rfpll_set_rate(ad9361_rf_phy_t* phy, //
     SPI_SDR_WriteM(phy->id_no, reg, buf, 5);
     SPI_SDR_WriteF(phy->id_no, REG_RFPLL_DIVIDERS, div_mask, vco_div);
 
+    clk_cache_invalidate(phy, clk_priv->source);
+
     // Load Gain Table
     if (clk_priv->source == RX_RFPLL) {
         _val = ad9361_load_gt(phy, ad9361_from_clk(rate), GT_RX1 + GT_RX2);
@@ -4937,6 +5397,8 @@ clk_t ad9361_clk_register(ad9361_rf_phy_t* phy, //
 
     phy->ref_clk_scale[source] = clk_priv;
 
+    clk_cache_invalidate(phy, source);
+
     switch (source) {
         case TX_REFCLK:
             clk.rate = ad9361_clk_factor_recalc_rate(phy, &clk_priv, phy->clk_refin.rate);
@@ -5080,6 +5542,10 @@ int32_t ad9361_dig_tune(ad9361_rf_phy_t* phy, //
                 ad9361_set_trx_clock_chain_freq(phy, k ? max_freq : 10000000UL);
             }
 
+            // NOTE: the sweep only probes the delays, the chosen one is written
+            // below, so a recorded bring-up skips its writes and waits
+            SPI_SDR_RecordMute(true);
+
             for (i = 0; i < 2; i++) {
                 for (j = 0; j < 16; j++) {
                     SPI_SDR_Write(phy->id_no, REG_RX_CLOCK_DATA_DELAY + t, RX_DATA_DELAY(i == 0 ? j : 0) | DATA_CLK_DELAY(i ? j : 0));
@@ -5093,6 +5559,8 @@ int32_t ad9361_dig_tune(ad9361_rf_phy_t* phy, //
                     field[i][j] |= _val;
                 }
             }
+
+            SPI_SDR_RecordMute(false);
         }
 
         c0 = ad9361_find_opt_delay(&field[0][0], 16, &s0);
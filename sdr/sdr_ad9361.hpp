@@ -58,6 +58,13 @@ typedef enum fir_dest {
 
 } fir_dest_t;
 
+typedef enum fir_verify {
+    FIR_VERIFY_FULL,    // read back every tap
+    FIR_VERIFY_SAMPLED, // checksum of one tap every FIR_VERIFY_STRIDE
+    FIR_VERIFY_OFF
+
+} fir_verify_t;
+
 typedef enum rf_gain_ctrl_mode {
     RF_GAIN_MGC,
     RF_GAIN_FASTATTACK_AGC,
@@ -424,6 +431,8 @@ typedef struct ad9361_phy_platform_data {
     gpo_control_t        gpo_ctrl;
     tx_monitor_control_t txmon_ctrl;
 
+    fir_verify_t fir_verify;
+
     int32_t gpio_resetb;
 
     // MCS SYNC
@@ -478,16 +487,32 @@ typedef struct clk {
 
 } clk_t;
 
+typedef struct fir_shadow {
+    int16_t coef[2][128]; // CH1, CH2
+    uint8_t ntaps[2];     // taps known to be loaded (0: unknown)
+
+} fir_shadow_t;
+
+typedef struct clk_cache {
+    bool     valid;
+    uint32_t parent_rate;
+    uint32_t rate;
+
+} clk_cache_t;
+
 typedef struct ad9361_rf_phy {
     uint8_t                    id_no;
     clk_t                      clk_refin;
     clk_t                      clks[NUM_AD9361_CLKS];
     refclk_scale_t             ref_clk_scale[NUM_AD9361_CLKS];
+    clk_cache_t                clk_cache[NUM_AD9361_CLKS];
     ad9361_phy_platform_data_t pdata;
     uint8_t                    prev_ensm_state;
     uint8_t                    curr_ensm_state;
     rx_gain_info_t             rx_gain[RXGAIN_TBLS_END];
     rx_gain_table_name_t       current_table;
+    uint32_t                   current_table_dest;
+    bool                       gm_st_loaded;
     bool                       ensm_pin_ctl_en;
     bool                       auto_cal_en;
     uint64_t                   last_tx_quad_cal_freq;
@@ -510,6 +535,7 @@ typedef struct ad9361_rf_phy {
     uint8_t                    tx_fir_ntaps;
     uint8_t                    rx_fir_dec;
     uint8_t                    rx_fir_ntaps;
+    fir_shadow_t               fir_shadow[2]; // TX, RX
     uint8_t                    agc_mode[2];
     bool                       rfdc_track_en;
     bool                       bbdc_track_en;
@@ -2777,7 +2803,7 @@ static const synth_lut_t synth_lut_tdd[LUT_FTDD_ENT][SYNTH_LUT_SIZE] = {
 // RX Gain Tables
 #define SIZE_FULL__TABLE 77
 #define SIZE_SPLIT_TABLE 41
-static const uint8_t full__gain_table[RXGAIN_TBLS_END][SIZE_FULL__TABLE][3] = {
+static constexpr uint8_t full__gain_table[RXGAIN_TBLS_END][SIZE_FULL__TABLE][3] = {
     {// 800 MHz
      {0x00, 0x00, 0x20}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x01, 0x00}, {0x00, 0x02, 0x00}, {0x00, 0x03, 0x00}, {0x00, 0x04, 0x00}, {0x00, 0x05, 0x00}, {0x01, 0x03, 0x20}, {0x01, 0x04, 0x00}, {0x01, 0x05, 0x00},
      {0x01, 0x06, 0x00}, {0x01, 0x07, 0x00}, {0x01, 0x08, 0x00}, {0x01, 0x09, 0x00}, {0x01, 0x0A, 0x00}, {0x01, 0x0B, 0x00}, {0x01, 0x0C, 0x00}, {0x01, 0x0D, 0x00}, {0x01, 0x0E, 0x00}, {0x02, 0x09, 0x20}, {0x02, 0x0A, 0x00},
@@ -2804,7 +2830,7 @@ static const uint8_t full__gain_table[RXGAIN_TBLS_END][SIZE_FULL__TABLE][3] = {
      {0x44, 0x24, 0x00}, {0x44, 0x25, 0x00}, {0x44, 0x26, 0x00}, {0x44, 0x27, 0x00}, {0x44, 0x28, 0x00}, {0x44, 0x29, 0x00}, {0x44, 0x2A, 0x00}, {0x44, 0x2B, 0x00}, {0x44, 0x2C, 0x00}, {0x44, 0x2D, 0x00}, {0x44, 0x2E, 0x00},
      {0x64, 0x2E, 0x20}, {0x64, 0x2F, 0x00}, {0x64, 0x30, 0x00}, {0x64, 0x31, 0x00}, {0x64, 0x32, 0x00}, {0x64, 0x33, 0x00}, {0x64, 0x34, 0x00}, {0x64, 0x35, 0x00}, {0x64, 0x36, 0x00}, {0x64, 0x37, 0x00}, {0x64, 0x38, 0x00},
      {0x65, 0x38, 0x20}, {0x66, 0x38, 0x20}, {0x67, 0x38, 0x20}, {0x68, 0x38, 0x20}, {0x69, 0x38, 0x20}, {0x6A, 0x38, 0x20}, {0x6B, 0x38, 0x20}, {0x6C, 0x38, 0x20}, {0x6D, 0x38, 0x20}, {0x6E, 0x38, 0x20}, {0x6F, 0x38, 0x20}}};
-static const uint8_t split_gain_table[RXGAIN_TBLS_END][SIZE_SPLIT_TABLE][3] = {
+static constexpr uint8_t split_gain_table[RXGAIN_TBLS_END][SIZE_SPLIT_TABLE][3] = {
     {
         // 800 MHz
         {0x00, 0x18, 0x20}, {0x00, 0x18, 0x00}, {0x00, 0x18, 0x00}, {0x00, 0x18, 0x00}, {0x00, 0x18, 0x00}, {0x00, 0x18, 0x00}, {0x00, 0x18, 0x20}, {0x01, 0x18, 0x20}, {0x02, 0x18, 0x20}, {0x04, 0x18, 0x20}, {0x04, 0x38, 0x20},
@@ -2828,8 +2854,8 @@ static const uint8_t split_gain_table[RXGAIN_TBLS_END][SIZE_SPLIT_TABLE][3] = {
     }};
 
 // Mixer GM Sub-table
-static const uint8_t gm_st_gain[] = {0x78, 0x74, 0x70, 0x6C, 0x68, 0x64, 0x60, 0x5C, 0x58, 0x54, 0x50, 0x4C, 0x48, 0x30, 0x18, 0x00};
-static const uint8_t gm_st_ctrl[] = {0x00, 0x0D, 0x15, 0x1B, 0x21, 0x25, 0x29, 0x2C, 0x2F, 0x31, 0x33, 0x34, 0x35, 0x3A, 0x3D, 0x3E};
+static constexpr uint8_t gm_st_gain[] = {0x78, 0x74, 0x70, 0x6C, 0x68, 0x64, 0x60, 0x5C, 0x58, 0x54, 0x50, 0x4C, 0x48, 0x30, 0x18, 0x00};
+static constexpr uint8_t gm_st_ctrl[] = {0x00, 0x0D, 0x15, 0x1B, 0x21, 0x25, 0x29, 0x2C, 0x2F, 0x31, 0x33, 0x34, 0x35, 0x3A, 0x3D, 0x3E};
 
 static const int8_t lna_table[]   = {6, 17, 19, 25};
 static const int8_t tia_table[]   = {-6, 0};
@@ -2843,6 +2869,8 @@ static const int8_t mixer_table[] = {0, 5, 11, 16, 17, 18, 19, 20, 21, 22, 23, 2
 
 uint32_t clk_get_rate(ad9361_rf_phy_t* phy, refclk_scale_t* clk_priv);
 int32_t  clk_set_rate(ad9361_rf_phy_t* phy, refclk_scale_t* clk_priv, uint32_t rate);
+void     clk_cache_invalidate(ad9361_rf_phy_t* phy, int32_t source);
+void     clk_recalc_rates(ad9361_rf_phy_t* phy);
 int32_t  ad9361_set_bist_loopback(ad9361_rf_phy_t* phy, int32_t mode);
 int32_t  ad9361_get_bist_loopback(ad9361_rf_phy_t* phy);
 int32_t  ad9361_bist_prbs(ad9361_rf_phy_t* phy, ad9361_bist_mode_t mode);
@@ -322,6 +322,9 @@ int32_t ad9361_init(ad9361_rf_phy_t*          phy, //
     phy->pdata.txmon_ctrl.tx1_mon_lo_cm               = init_param->tx1_mon_lo_cm;
     phy->pdata.txmon_ctrl.tx2_mon_lo_cm               = init_param->tx2_mon_lo_cm;
 
+    // FIR filter verification
+    phy->pdata.fir_verify = (fir_verify_t)init_param->fir_verify_mode;
+
     phy->pdata.debug_mode = true;
 
     phy->pdata.port_ctrl.digital_io_ctrl = 0;
@@ -330,13 +333,15 @@ int32_t ad9361_init(ad9361_rf_phy_t*          phy, //
 
     phy->rx_eq_2tx = false;
 
-    phy->current_table = RXGAIN_TBLS_END;
-    phy->bypass_tx_fir = true;
-    phy->bypass_rx_fir = true;
-    phy->rate_governor = 1;
-    phy->rfdc_track_en = true;
-    phy->bbdc_track_en = true;
-    phy->quad_track_en = true;
+    phy->current_table      = RXGAIN_TBLS_END;
+    phy->current_table_dest = 0;
+    phy->gm_st_loaded       = false;
+    phy->bypass_tx_fir      = true;
+    phy->bypass_rx_fir      = true;
+    phy->rate_governor      = 1;
+    phy->rfdc_track_en      = true;
+    phy->bbdc_track_en      = true;
+    phy->quad_track_en      = true;
 
     phy->bist_loopback_mode = 0;
     phy->bist_prbs_mode     = BIST_DISABLE;
@@ -516,6 +521,24 @@ int32_t ad9361_do_calib(ad9361_rf_phy_t* phy, //
     return ad9361_do_calib_run(phy, cal, arg);
 }
 
+/**
+ * Set the FIR filter verification mode.
+ * @param phy The AD9361 state structure.
+ * @param mode The verification mode (FIR_VERIFY_FULL, FIR_VERIFY_SAMPLED, FIR_VERIFY_OFF).
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_set_fir_verify(ad9361_rf_phy_t* phy, //
+                              fir_verify_t     mode) {
+
+    if (mode > FIR_VERIFY_OFF) {
+        return -EINVAL;
+    }
+
+    phy->pdata.fir_verify = mode;
+
+    return 0;
+}
+
 /* *****************************************************************************
  End of File
  */
@@ -289,6 +289,9 @@ typedef struct ad9361_init_parameters {
     uInt32 tx1_mon_lo_cm;               // txmon-1-lo-cm
     uInt32 tx2_mon_lo_cm;               // txmon-2-lo-cm
 
+    // FIR filter verification
+    uInt08 fir_verify_mode; // 0 full, 1 sampled, 2 off
+
 } ad9361_init_parameters_t;
 
 typedef struct ad9361_rx_fir_config {
@@ -335,6 +338,8 @@ int32_t ad9361_get_tx_lo_freq(ad9361_rf_phy_t* phy, uint64_t* lo_freq_hz);
 int32_t ad9361_set_tx_fir_config(ad9361_rf_phy_t* phy, ad9361_tx_fir_config_t fir_cfg);
 // Perform the selected calibration.
 int32_t ad9361_do_calib(ad9361_rf_phy_t* phy, uint32_t cal, int32_t arg);
+// Set the FIR filter verification mode.
+int32_t ad9361_set_fir_verify(ad9361_rf_phy_t* phy, fir_verify_t mode);
 
 #endif /* SDR_AD9361_API_HPP */
 
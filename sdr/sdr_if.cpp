@@ -24,13 +24,23 @@
 // STD libraries
 #include "definitions.hpp" // SYS function prototypes
 
+#include <algorithm> // min
+#include <chrono>    // microseconds
 #include <cinttypes>
+#include <cstring> // memcmp
+#include <fstream> // ifstream, ofstream
+#include <string>  // string
+#include <thread>  // this_thread
 
 // project libraries
 #include "GLogger.hpp"
 #include "GRegisters.hpp"     // set_bit, to_bits
 #include "sdr_ad9361_api.hpp" // SDR AD9361 API
+#include "sdr_if.hpp"         // SDR interface API
+#include "sdr_profile.hpp"    // SDR profile switch
+#include "sdr_telemetry.hpp"  // SDR telemetry
 #include "spi_if.hpp"         // SPI interface API
+#include "spi_sim.hpp"        // SIM_IsActive, SIM_TraceStart, SIM_TraceStop
 
 // *****************************************************************************
 // *****************************************************************************
@@ -48,6 +58,9 @@
 
 ad9361_rf_phy_t ad9361_phy[SPI_SDR_NUM];
 
+// driver state sidecar of a recorded SPI script: magic (4), size (4), state
+static const char PHY_STATE_MAGIC[4]{'P', 'H', 'Y', '1'};
+
 ad9361_init_parameters_t init_params = {
     // identification number
     (uInt08)SPI_SDR1_CS, // id_no
@@ -329,7 +342,10 @@ ad9361_init_parameters_t init_params = {
     (uInt32)2,     // tx1_mon_front_end_gain
     (uInt32)2,     // tx2_mon_front_end_gain
     (uInt32)48,    // tx1_mon_lo_cm
-    (uInt32)48     // tx2_mon_lo_cm
+    (uInt32)48,    // tx2_mon_lo_cm
+
+    // FIR filter verification
+    (uInt08)FIR_VERIFY_FULL // fir_verify_mode
 };
 
 ad9361_tx_fir_config_t tx_fir_config = {
@@ -391,30 +407,136 @@ ad9361_rx_fir_config_t rx_fir_config = {
 // *****************************************************************************
 
 // *****************************************************************************
-/* void SDR_DumpRegs(uint8_t module)
+/* void SDR_DumpRegs(uint8_t module, const char* filename)
 
   Summary:
-    Dump to UART a full SDR (AD9361) internal registers image.
+    Dump a full SDR (AD9361) internal registers image.
 
   Description:
-    Dump to UART a full SDR (AD9361) internal registers image. Target module
-    is selected by 'module' input parameter.
+    Dump a full SDR (AD9361) internal registers image, taken by SDR_Snapshot.
+    The image is logged 16 registers per line or, when 'filename' is given,
+    written to file as raw binary. Target module is selected by 'module' input
+    parameter.
 
   Remarks:
     None.
 */
-void SDR_DumpRegs(uint8_t module) {
+void SDR_DumpRegs(uint8_t     module, //
+                  const char* filename) {
+    sdr_snapshot_t _snapshot;
+
+    if (!SDR_Snapshot(module, &_snapshot)) {
+        LOG_FORMAT(error, "SDR (AD9361) dump failure (%s)", __func__);
+        return;
+    }
+
+    if (filename != nullptr) {
+        SDR_SnapshotSave(&_snapshot, filename);
+        return;
+    }
+
     LOG_FORMAT(debug, "SDR (AD9361) dump started (%s)", __func__);
 
-    // loop over all SDR internal registers...
-    for (uint16_t reg{0x000}; reg < 0x400; ++reg) {
-        auto _val = SPI_SDR_Read(module, reg);
-        LOG_FORMAT(debug, "  GET register 0x%03X : 0x%02X (%3d)", reg, _val, _val);
+    // loop over all SDR internal registers, one row of 16 at a time...
+    for (uint16_t reg{0x000}; reg < SDR_REGS_NUM; reg += 16) {
+        const auto* _row{&_snapshot.regs[reg]};
+
+        LOG_FORMAT(debug, "  GET registers 0x%03X : %02X %02X %02X %02X %02X %02X %02X %02X  %02X %02X %02X %02X %02X %02X %02X %02X", reg, //
+                   _row[0], _row[1], _row[2], _row[3], _row[4], _row[5], _row[6], _row[7],                                         //
+                   _row[8], _row[9], _row[10], _row[11], _row[12], _row[13], _row[14], _row[15]);
     }
 
     LOG_FORMAT(debug, "SDR (AD9361) dump stopped (%s)", __func__);
 }
 
+// *****************************************************************************
+/* bool SDR_PhyStateSave(const ad9361_rf_phy_t* phy, const char* script)
+
+  Summary:
+    Write the driver state of an SDR (AD9361) module next to its SPI script.
+
+  Description:
+    Write 'phy' to the '<script>.phy' file as a raw binary image, preceded by
+    a magic and the image size.
+
+  Remarks:
+    The state holds no pointers but the clock names, which are never used.
+*/
+static bool SDR_PhyStateSave(const ad9361_rf_phy_t* phy, //
+                             const char*            script) {
+    auto _ret{false};
+
+    const auto _filename{std::string(script) + ".phy"};
+    const auto _size{(uint32_t)sizeof(ad9361_rf_phy_t)};
+
+    std::ofstream ofs;
+    ofs.open(_filename, std::ios::binary);
+
+    if (ofs.is_open()) {
+        ofs.write(PHY_STATE_MAGIC, sizeof(PHY_STATE_MAGIC));
+        ofs.write((const char*)&_size, sizeof(_size));
+        ofs.write((const char*)phy, sizeof(ad9361_rf_phy_t));
+        _ret = ofs.good();
+        ofs.close();
+    }
+
+    if (!_ret) {
+        LOG_FORMAT(error, "SDR (AD9361) state failure [file: %s] (%s)", _filename.c_str(), __func__);
+    }
+    return _ret;
+}
+
+// *****************************************************************************
+/* bool SDR_PhyStateLoad(ad9361_rf_phy_t* phy, const char* script)
+
+  Summary:
+    Read the driver state of an SDR (AD9361) module saved next to its SPI script.
+
+  Description:
+    Read into 'phy' the '<script>.phy' file written by SDR_PhyStateSave. The
+    clock names are cleared and the memoized clock rates are dropped.
+
+  Remarks:
+    Files with a different magic or image size (other build) are rejected.
+*/
+static bool SDR_PhyStateLoad(ad9361_rf_phy_t* phy, //
+                             const char*      script) {
+    auto _ret{false};
+
+    const auto _filename{std::string(script) + ".phy"};
+
+    char     _magic[sizeof(PHY_STATE_MAGIC)]{};
+    uint32_t _size{0};
+
+    std::ifstream ifs;
+    ifs.open(_filename, std::ios::binary);
+
+    if (ifs.is_open()) {
+        ifs.read(_magic, sizeof(_magic));
+        ifs.read((char*)&_size, sizeof(_size));
+
+        if (ifs.good() && memcmp(_magic, PHY_STATE_MAGIC, sizeof(_magic)) == 0 && _size == sizeof(ad9361_rf_phy_t)) {
+            ifs.read((char*)phy, sizeof(ad9361_rf_phy_t));
+            _ret = ifs.gcount() == (std::streamsize)sizeof(ad9361_rf_phy_t);
+        }
+        ifs.close();
+    }
+
+    if (!_ret) {
+        LOG_FORMAT(warning, "SDR (AD9361) state not valid [file: %s] (%s)", _filename.c_str(), __func__);
+        return false;
+    }
+
+    phy->clk_refin.name = nullptr;
+
+    for (auto& clk : phy->clks) {
+        clk.name = nullptr;
+    }
+
+    clk_cache_invalidate(phy, -1);
+    return true;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: interface functions
@@ -435,6 +557,8 @@ void SDR_DumpRegs(uint8_t module) {
     None.
 */
 void SDR_Reset(uint8_t module) {
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
     LOG_FORMAT(debug, "Assert reset for module %d (%s)", module, __func__);
     SPI_FPGA_Write(AD9361_RESET_ADDR, AD9361_RESET_ASSERT);
 
@@ -455,6 +579,8 @@ void SDR_Reset(uint8_t module) {
     None.
 */
 void SDR_SoftReset(uint8_t module) {
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
     LOG_FORMAT(debug, "Assert soft-reset for module %d (%s)", module, __func__);
     SPI_SDR_Write(module, REG_SPI_CONF, SOFT_RESET | _SOFT_RESET);
 
@@ -478,6 +604,8 @@ void SDR_SoftReset(uint8_t module) {
 void SDR_SelfTest(uint8_t module, //
                   bool    pre_reset) {
 
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
     uint8_t _val{0};
 
     LOG_FORMAT(debug, "SDR (AD9361) test started (%s)", __func__);
@@ -592,6 +720,8 @@ bool SDR_Configure(uint8_t module) {
 
     // check module parameter is in allowed range
     if (module < SPI_SDR_NUM) {
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
         // AD9361 initialize device
         ad9361_init(&ad9361_phy[module], &init_params);
 
@@ -612,6 +742,202 @@ bool SDR_Configure(uint8_t module) {
     return false;
 }
 
+// *****************************************************************************
+/* bool SDR_WarmBoot(uint8_t module, const char* script)
+
+  Summary:
+    Configure SDR (AD9361) module from a recorded SPI script.
+
+  Description:
+    Replay the SPI script of a previous bring-up of the same configuration.
+    If the script is missing or stale, a full SDR_Configure is run while the
+    SPI recorder captures it, and the script is (re)written for the next boot.
+    Selected module is defined by 'module' input parameter.
+
+  Remarks:
+    The driver state of the module ('ad9361_phy') is saved next to the script
+    ('<script>.phy') and restored with it: a script without its state, or a
+    replay that fails (e.g. a calibration poll timeout), falls back to the
+    full configuration.
+*/
+bool SDR_WarmBoot(uint8_t     module, //
+                  const char* script) {
+
+    // check module parameter is in allowed range
+    if (module < SPI_SDR_NUM) {
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+        ad9361_rf_phy_t _phy{};
+
+        if (SDR_PhyStateLoad(&_phy, script) && SPI_SDR_Replay(module, script)) {
+            // check ENSM internal state
+            uint8_t ENSM_state = ENSM_STATE(SPI_SDR_Read(module, REG_STATE));
+            if (ENSM_state == ENSM_STATE_FDD) {
+                LOG_FORMAT(info, "ENSM in FDD state 0x%02X (%s)", ENSM_state, __func__);
+                ad9361_phy[module] = _phy;
+                return true;
+            }
+            LOG_FORMAT(warning, "Stale SPI script, full configuration required (%s)", __func__);
+        }
+
+        SPI_SDR_RecordStart();
+
+        auto _ret{SDR_Configure(module)};
+
+        if (SPI_SDR_RecordStop(_ret ? script : nullptr)) {
+            SDR_PhyStateSave(&ad9361_phy[module], script);
+        }
+        return _ret;
+    }
+    return false;
+}
+
+// *****************************************************************************
+/* bool SDR_Snapshot(uint8_t module, sdr_snapshot_t* snapshot)
+
+  Summary:
+    Read a full SDR (AD9361) internal registers image.
+
+  Description:
+    Read all the SDR (AD9361) internal registers into 'snapshot', using
+    multi-byte (AD_CNT) SPI bursts of MAX_MBYTE_SPI registers. Selected module
+    is defined by 'module' input parameter.
+
+  Remarks:
+    A burst walks the register map downwards, so each one starts from the
+    highest address of its block.
+*/
+bool SDR_Snapshot(uint8_t         module, //
+                  sdr_snapshot_t* snapshot) {
+
+    // check module parameter is in allowed range
+    if (module < SPI_SDR_NUM && snapshot != nullptr) {
+        // NOTE: one image, the bursts must not be interleaved with writes
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+        uint8_t _buf[MAX_MBYTE_SPI];
+
+        for (uint32_t reg{MAX_MBYTE_SPI - 1}; reg < SDR_REGS_NUM; reg += MAX_MBYTE_SPI) {
+            if (!SPI_SDR_ReadM(module, reg, _buf, MAX_MBYTE_SPI)) {
+                return false;
+            }
+
+            for (uint32_t i{0}; i < MAX_MBYTE_SPI; ++i) {
+                snapshot->regs[reg - i] = _buf[i];
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+// *****************************************************************************
+/* uint32_t SDR_SnapshotDiff(const sdr_snapshot_t* before,
+                             const sdr_snapshot_t* after,
+                             uint16_t*             regs)
+
+  Summary:
+    Compare two SDR (AD9361) internal registers images.
+
+  Description:
+    Log the registers whose value differs between 'before' and 'after', and
+    return their number. If 'regs' is given (SDR_REGS_NUM entries at least),
+    the changed addresses are stored there in ascending order.
+
+  Remarks:
+    None.
+*/
+uint32_t SDR_SnapshotDiff(const sdr_snapshot_t* before, //
+                          const sdr_snapshot_t* after,  //
+                          uint16_t*             regs) {
+    uint32_t _changes{0};
+
+    if (before != nullptr && after != nullptr) {
+        for (uint16_t reg{0x000}; reg < SDR_REGS_NUM; ++reg) {
+            if (before->regs[reg] != after->regs[reg]) {
+                LOG_FORMAT(debug, "  DIFF register 0x%03X : 0x%02X -> 0x%02X", reg, before->regs[reg], after->regs[reg]);
+
+                if (regs != nullptr) {
+                    regs[_changes] = reg;
+                }
+                _changes++;
+            }
+        }
+        LOG_FORMAT(debug, "SDR (AD9361) registers changed: %u (%s)", _changes, __func__);
+    }
+    return _changes;
+}
+
+// *****************************************************************************
+/* bool SDR_SnapshotSave(const sdr_snapshot_t* snapshot, const char* filename)
+
+  Summary:
+    Write an SDR (AD9361) internal registers image to file.
+
+  Description:
+    Write 'snapshot' to 'filename' as a raw binary image of SDR_REGS_NUM bytes
+    (byte offset equal to register address), for offline comparison.
+
+  Remarks:
+    None.
+*/
+bool SDR_SnapshotSave(const sdr_snapshot_t* snapshot, //
+                      const char*           filename) {
+    auto _ret{false};
+
+    if (snapshot != nullptr && filename != nullptr) {
+        std::ofstream ofs;
+        ofs.open(filename, std::ios::binary);
+
+        if (ofs.is_open()) {
+            ofs.write((const char*)snapshot->regs, sizeof(snapshot->regs));
+            _ret = ofs.good();
+            ofs.close();
+        }
+    }
+
+    if (_ret) {
+        LOG_FORMAT(info, "SDR (AD9361) image saved [file: %s] (%s)", filename, __func__);
+    }
+    else {
+        LOG_FORMAT(error, "SDR (AD9361) image failure [file: %s] (%s)", filename != nullptr ? filename : "", __func__);
+    }
+    return _ret;
+}
+
+// *****************************************************************************
+/* bool SDR_SnapshotLoad(sdr_snapshot_t* snapshot, const char* filename)
+
+  Summary:
+    Read an SDR (AD9361) internal registers image from file.
+
+  Description:
+    Read into 'snapshot' a raw binary image written by SDR_SnapshotSave.
+
+  Remarks:
+    Files shorter than SDR_REGS_NUM bytes are rejected.
+*/
+bool SDR_SnapshotLoad(sdr_snapshot_t* snapshot, //
+                      const char*     filename) {
+    auto _ret{false};
+
+    if (snapshot != nullptr && filename != nullptr) {
+        std::ifstream ifs;
+        ifs.open(filename, std::ios::binary);
+
+        if (ifs.is_open()) {
+            ifs.read((char*)snapshot->regs, sizeof(snapshot->regs));
+            _ret = ifs.gcount() == (std::streamsize)sizeof(snapshot->regs);
+            ifs.close();
+        }
+    }
+
+    if (!_ret) {
+        LOG_FORMAT(error, "SDR (AD9361) image failure [file: %s] (%s)", filename != nullptr ? filename : "", __func__);
+    }
+    return _ret;
+}
+
 // *****************************************************************************
 /* void SDR_BIST_Start(uint8_t module)
 
@@ -628,6 +954,8 @@ bool SDR_Configure(uint8_t module) {
 void SDR_BIST_Start(uint8_t module, //
                     bool    prbs_mode) {
 
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
     LOG_FORMAT(info, "SDR (AD9361) BIST started (%s)", __func__);
 
     SPI_SDR_Write(module, REG_OBSERVE_CONFIG, 0x40);
@@ -657,6 +985,8 @@ void SDR_BIST_Start(uint8_t module, //
 */
 void SDR_BIST_Stop(uint8_t module) {
 
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
     LOG_FORMAT(info, "SDR (AD9361) BIST stopped (%s)", __func__);
 
     SPI_SDR_Write(module, REG_OBSERVE_CONFIG, 0x00);
@@ -701,6 +1031,9 @@ void SDR_TXRX_LO_Test(uint8_t  module, //
 
         // test all frequency
         for (uint8_t i = 0; i < 6; i += 1) {
+            // NOTE: one frequency at a time, the bus is released in between
+            spi_bus_lock_t _bus(SPI_SDR_Bus());
+
             // set TX and RX LO frequency
             ad9361_set_tx_lo_freq(&ad9361_phy[module], tx_lo_frequency_table[i]);
             ad9361_set_rx_lo_freq(&ad9361_phy[module], tx_lo_frequency_table[i] + rx_lo_frequency_offset);
@@ -782,6 +1115,8 @@ void SDR_TX_Atten_Test(uint8_t module) {
     uint32_t tx_attenuation = 45000;
 
     while (true) {
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
         // set TX attenuation - channel 1
         ad9361_set_tx_attenuation(&ad9361_phy[module], 0, tx_attenuation);
         // update TX attenuation
@@ -789,6 +1124,191 @@ void SDR_TX_Atten_Test(uint8_t module) {
     }
 }
 
+// *****************************************************************************
+/* bool SDR_Profile_Test(uint8_t module, uint32_t rx_lo_offset)
+
+  Summary:
+    SDR (AD9361) module profile switch test.
+
+  Description:
+    Capture the current configuration and a copy with the RX LO moved by
+    'rx_lo_offset', then switch back and forth between them (the later
+    switches replay cached deltas). The test passes when the registers match
+    the final profile and the driver reads back the original RX LO.
+    Selected module is defined by 'module' input parameter.
+
+  Remarks:
+    The module is left in its original configuration.
+*/
+bool SDR_Profile_Test(uint8_t  module, //
+                      uint32_t rx_lo_offset) {
+
+    static sdr_profile_t profiles[2];
+
+    sdr_profile_t       live_profile{};
+    sdr_profile_delta_t residue{};
+
+    // RX LO frequency read-back values
+    uint64_t rx_lo_frequency_base   = 0UL;
+    uint64_t rx_lo_frequency_rvalue = 0UL;
+
+    // check module parameter is in allowed range
+    if (module >= SPI_SDR_NUM) {
+        return false;
+    }
+
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+    ad9361_get_rx_lo_freq(&ad9361_phy[module], &rx_lo_frequency_base);
+
+    // capture the base and the retuned profiles
+    profiles[0].id = 0;
+    profiles[1].id = 1;
+
+    auto _ret{PROFILE_Capture(module, &profiles[0])};
+
+    ad9361_set_rx_lo_freq(&ad9361_phy[module], rx_lo_frequency_base + rx_lo_offset);
+
+    _ret = _ret && PROFILE_Capture(module, &profiles[1]);
+
+    // the retune was written outside the profile switch
+    PROFILE_Forget(module);
+
+    // back and forth, ending on the base profile
+    for (auto i{0}; _ret && i < 5; ++i) {
+        _ret = PROFILE_Switch(module, &profiles[i % 2]);
+
+        ad9361_get_rx_lo_freq(&ad9361_phy[module], &rx_lo_frequency_rvalue);
+        LOG_FORMAT(debug, "Profile %d, RX LO frequency %" PRIu64 " Hz (%s)", i % 2, rx_lo_frequency_rvalue, __func__);
+    }
+
+    // compare the live registers with the base profile
+    _ret = _ret && PROFILE_Capture(module, &live_profile) && PROFILE_Diff(&live_profile, &profiles[0], &residue);
+    _ret = _ret && residue.changes == 0 && rx_lo_frequency_rvalue == rx_lo_frequency_base;
+
+    PROFILE_Forget(module);
+
+    if (!_ret) {
+        LOG_FORMAT(error, "Profile test FAILED [residue: %u] (%s)", residue.changes, __func__);
+        return false;
+    }
+
+    LOG_FORMAT(info, "Profile test passed (%s)", __func__);
+    return true;
+}
+
+// *****************************************************************************
+/* bool SDR_Bus_Test(uint8_t module, uint32_t rx_lo_offset, uint32_t switches)
+
+  Summary:
+    SDR (AD9361) module bus exclusivity test.
+
+  Description:
+    Run the telemetry sampler while switching 'switches' times between the
+    current configuration and a copy with the RX LO moved by 'rx_lo_offset'.
+    Every switch is traced by the simulated device: the test passes when no
+    telemetry transaction lands between the first and the last transaction of
+    a switch. Selected module is defined by 'module' input parameter.
+
+  Remarks:
+    Simulated device only. The module is left in its original configuration.
+*/
+bool SDR_Bus_Test(uint8_t  module, //
+                  uint32_t rx_lo_offset,
+                  uint32_t switches) {
+
+    static sdr_profile_t profiles[2];
+
+    // RX LO frequency read-back value
+    uint64_t rx_lo_frequency_base = 0UL;
+
+    // check module parameter is in allowed range
+    if (module >= SPI_SDR_NUM || !SIM_IsActive()) {
+        return false;
+    }
+
+    {
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+        ad9361_get_rx_lo_freq(&ad9361_phy[module], &rx_lo_frequency_base);
+
+        // capture the base and the retuned profiles
+        profiles[0].id = 0;
+        profiles[1].id = 1;
+
+        auto _ret{PROFILE_Capture(module, &profiles[0])};
+
+        ad9361_set_rx_lo_freq(&ad9361_phy[module], rx_lo_frequency_base + rx_lo_offset);
+
+        _ret = _ret && PROFILE_Capture(module, &profiles[1]);
+
+        // the retune was written outside the profile switch
+        PROFILE_Forget(module);
+
+        if (!_ret) {
+            LOG_FORMAT(error, "Bus test FAILED [capture] (%s)", __func__);
+            return false;
+        }
+    }
+
+    const telem_config_t _config{module, 50, 2, {TELEM_TEMPERATURE, TELEM_RX_RSSI}};
+
+    if (!TELEM_Start(&_config)) {
+        LOG_FORMAT(error, "Bus test FAILED [telemetry] (%s)", __func__);
+        return false;
+    }
+
+    auto     _ret{true};
+    uint32_t _interleaved{0};
+
+    // back and forth, ending on the base profile
+    for (uint32_t i{0}; _ret && i < (switches | 1); ++i) {
+        SIM_TraceStart();
+
+        _ret = PROFILE_Switch(module, &profiles[i % 2]);
+
+        auto _trace{SIM_TraceStop()};
+
+        // the switch transactions must form a single run
+        size_t _first{_trace.size()};
+        size_t _last{0};
+
+        for (size_t j{0}; j < _trace.size(); ++j) {
+            if (_trace[j] == std::this_thread::get_id()) {
+                _first = std::min(_first, j);
+                _last  = j;
+            }
+        }
+
+        for (auto j{_first}; j < _last; ++j) {
+            if (_trace[j] != std::this_thread::get_id()) {
+                _interleaved++;
+            }
+        }
+
+        // NOTE: the sampler takes its turn, so it is pending during the next switch
+        auto _count{TELEM_Count()};
+
+        for (auto j{0}; TELEM_Count() == _count && j < 100; ++j) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    TELEM_Stop();
+
+    auto _samples{TELEM_Count()};
+
+    PROFILE_Forget(module);
+
+    if (!_ret || _interleaved != 0 || _samples == 0) {
+        LOG_FORMAT(error, "Bus test FAILED [interleaved: %u, samples: %lu] (%s)", _interleaved, _samples, __func__);
+        return false;
+    }
+
+    LOG_FORMAT(info, "Bus test passed [switches: %u, samples: %lu] (%s)", switches | 1, _samples, __func__);
+    return true;
+}
+
 /* *****************************************************************************
  End of File
  */
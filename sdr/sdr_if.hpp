@@ -32,19 +32,33 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#define SDR_REGS_NUM 0x400
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Data Types
 // *****************************************************************************
 // *****************************************************************************
 
+typedef struct sdr_snapshot {
+    uint8_t regs[SDR_REGS_NUM];
+} sdr_snapshot_t;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Functions
 // *****************************************************************************
 // *****************************************************************************
 
-void SDR_DumpRegs(uint8_t module);
+void SDR_DumpRegs(uint8_t module, const char* filename = nullptr);
+
+bool SDR_Snapshot(uint8_t module, sdr_snapshot_t* snapshot);
+
+uint32_t SDR_SnapshotDiff(const sdr_snapshot_t* before, const sdr_snapshot_t* after, uint16_t* regs = nullptr);
+
+bool SDR_SnapshotSave(const sdr_snapshot_t* snapshot, const char* filename);
+
+bool SDR_SnapshotLoad(sdr_snapshot_t* snapshot, const char* filename);
 
 void SDR_Reset(uint8_t module);
 
@@ -54,6 +68,8 @@ void SDR_SelfTest(uint8_t module, bool pre_reset = false);
 
 bool SDR_Configure(uint8_t module);
 
+bool SDR_WarmBoot(uint8_t module, const char* script);
+
 void SDR_BIST_Start(uint8_t module, bool prbs_mode);
 
 void SDR_BIST_Stop(uint8_t module);
@@ -62,6 +78,10 @@ void SDR_TXRX_LO_Test(uint8_t module, uint32_t rx_lo_offset, bool bist_mode);
 
 void SDR_TX_Atten_Test(uint8_t module);
 
+bool SDR_Profile_Test(uint8_t module, uint32_t rx_lo_offset);
+
+bool SDR_Bus_Test(uint8_t module, uint32_t rx_lo_offset, uint32_t switches);
+
 #endif /* SDR_IF_HPP */
 
 /* *****************************************************************************
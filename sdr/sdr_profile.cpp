@@ -0,0 +1,398 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      sdr_profile.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sdr_profile.hpp"
+
+#include "GLogger.hpp"
+#include "definitions.hpp"
+#include "sdr_ad9361.hpp"
+
+#include <array> // array
+
+// NOTE: defined by the SDR interface (sdr_if.cpp)
+extern ad9361_rf_phy_t ad9361_phy[SPI_SDR_NUM];
+
+// SECTION: register classes
+
+// Every register of the image belongs to one class. The class decides if the
+// register takes part in the diff and where its write lands in the delta.
+enum {
+    REG_CLASS_PLAIN = 0, // written in descending address order
+    REG_CLASS_SKIP,      // read-only, volatile, self-clearing or indirect port
+    REG_CLASS_ENSM,      // written last, after the synthesizers relock
+    REG_CLASS_BBPLL_CFG, // BBPLL loop config, written before the BBPLL word
+    REG_CLASS_BBPLL_WORD,
+    REG_CLASS_RX_SYNTH_CFG,
+    REG_CLASS_RX_SYNTH_WORD,
+    REG_CLASS_TX_SYNTH_CFG,
+    REG_CLASS_TX_SYNTH_WORD,
+};
+
+typedef std::array<uint8_t, SDR_REGS_NUM> reg_class_table_t;
+
+static constexpr void __mark(reg_class_table_t& table, uint32_t first, uint32_t last, uint8_t reg_class) {
+    for (auto reg{first}; reg <= last; ++reg) {
+        table[reg] = reg_class;
+    }
+}
+
+static constexpr reg_class_table_t __make_reg_class_table() {
+    reg_class_table_t _table{};
+
+    __mark(_table, 0x013, 0x015, REG_CLASS_ENSM);
+
+    __mark(_table, 0x041, 0x044, REG_CLASS_BBPLL_WORD);
+    __mark(_table, 0x045, 0x04E, REG_CLASS_BBPLL_CFG);
+
+    __mark(_table, 0x230, 0x230, REG_CLASS_RX_SYNTH_CFG);
+    __mark(_table, 0x231, 0x235, REG_CLASS_RX_SYNTH_WORD);
+    __mark(_table, 0x236, 0x261, REG_CLASS_RX_SYNTH_CFG);
+
+    __mark(_table, 0x270, 0x270, REG_CLASS_TX_SYNTH_CFG);
+    __mark(_table, 0x271, 0x275, REG_CLASS_TX_SYNTH_WORD);
+    __mark(_table, 0x276, 0x2A1, REG_CLASS_TX_SYNTH_CFG);
+
+    // NOTE: marked last, so they override the groups above
+    __mark(_table, 0x000, 0x000, REG_CLASS_SKIP); // SPI configuration
+    __mark(_table, 0x00C, 0x00C, REG_CLASS_SKIP); // temperature reading trigger
+    __mark(_table, 0x00E, 0x00E, REG_CLASS_SKIP); // temperature
+    __mark(_table, 0x016, 0x017, REG_CLASS_SKIP); // calibration control, state
+    __mark(_table, 0x01E, 0x01F, REG_CLASS_SKIP); // AuxADC word
+    __mark(_table, 0x037, 0x037, REG_CLASS_SKIP); // product ID
+    __mark(_table, 0x03F, 0x03F, REG_CLASS_SKIP); // SDM control 1 (BBPLL reset)
+    __mark(_table, 0x05E, 0x05F, REG_CLASS_SKIP); // overflow and BBPLL lock
+    __mark(_table, 0x060, 0x065, REG_CLASS_SKIP); // TX FIR port
+    __mark(_table, 0x06B, 0x06D, REG_CLASS_SKIP); // TX RSSI
+    __mark(_table, 0x0A7, 0x0A9, REG_CLASS_SKIP); // TX quadrature tracking
+    __mark(_table, 0x0F0, 0x0F5, REG_CLASS_SKIP); // RX FIR port
+    __mark(_table, 0x130, 0x142, REG_CLASS_SKIP); // gain table port
+    __mark(_table, 0x144, 0x144, REG_CLASS_SKIP); // gain table config
+    __mark(_table, 0x160, 0x163, REG_CLASS_SKIP); // RX FE gain readback
+    __mark(_table, 0x19A, 0x1A5, REG_CLASS_SKIP); // RX gain and RSSI readback
+    __mark(_table, 0x1A7, 0x1AE, REG_CLASS_SKIP); // RX power readback
+    __mark(_table, 0x226, 0x226, REG_CLASS_SKIP); // REF divider resync
+    __mark(_table, 0x244, 0x244, REG_CLASS_SKIP); // RX CP calibration
+    __mark(_table, 0x247, 0x247, REG_CLASS_SKIP); // RX VCO lock
+    __mark(_table, 0x25A, 0x25F, REG_CLASS_SKIP); // RX fastlock port
+    __mark(_table, 0x284, 0x284, REG_CLASS_SKIP); // TX CP calibration
+    __mark(_table, 0x287, 0x287, REG_CLASS_SKIP); // TX VCO lock
+    __mark(_table, 0x296, 0x29F, REG_CLASS_SKIP); // TX VCO readback, fastlock port
+    __mark(_table, 0x2B0, 0x2B9, REG_CLASS_SKIP); // DCXO and REF readback
+    __mark(_table, 0x3E0, 0x3FF, REG_CLASS_SKIP); // BIST and test
+
+    return _table;
+}
+
+static constexpr auto reg_class_table{__make_reg_class_table()};
+
+static_assert(reg_class_table[REG_CALIBRATION_CTRL] == REG_CLASS_SKIP);
+static_assert(reg_class_table[REG_ENSM_CONFIG_1] == REG_CLASS_ENSM);
+static_assert(reg_class_table[REG_RX_CP_OVERRANGE_VCO_LOCK] == REG_CLASS_SKIP);
+
+// SECTION: switch state
+
+#define PROFILE_CACHE_NUM 8
+
+static const sdr_profile_t* profile_current[SPI_SDR_NUM];
+static sdr_profile_t        profile_live[SPI_SDR_NUM];
+static sdr_profile_delta_t  profile_cache[SPI_SDR_NUM][PROFILE_CACHE_NUM];
+static uint32_t             profile_cache_next[SPI_SDR_NUM];
+
+// SECTION: helpers
+
+// Appends the 'to' values of the given registers (descending order) to the
+// script, as runs of adjacent registers up to MAX_MBYTE_SPI bytes long.
+static void __emit(spi_script_t& script, const sdr_profile_t* to, const uint32_t* regs, uint32_t regs_num) {
+    uint32_t i{0};
+
+    while (i < regs_num) {
+        uint8_t  _burst[MAX_MBYTE_SPI];
+        uint32_t _len{0};
+        auto     _addr{regs[i]};
+
+        while (i < regs_num && _len < MAX_MBYTE_SPI && regs[i] == _addr - _len) {
+            _burst[_len++] = to->image.regs[regs[i++]];
+        }
+        SPI_SCRIPT_Write(script, _addr, _burst, _len);
+    }
+}
+
+static void __emit_byte(spi_script_t& script, uint32_t reg, uint8_t val) {
+    SPI_SCRIPT_Write(script, reg, &val, 1);
+}
+
+// Collects (descending) the registers of a class that differ between images.
+static uint32_t __collect(const sdr_profile_t* from, const sdr_profile_t* to, uint8_t reg_class, uint32_t* regs) {
+    uint32_t _num{0};
+
+    for (uint32_t reg{SDR_REGS_NUM}; reg-- > 0;) {
+        if (reg_class_table[reg] == reg_class && from->image.regs[reg] != to->image.regs[reg]) {
+            regs[_num++] = reg;
+        }
+    }
+    return _num;
+}
+
+// Collects (descending) all the registers of a class, changed or not.
+static uint32_t __collect_all(uint8_t reg_class, uint32_t* regs) {
+    uint32_t _num{0};
+
+    for (uint32_t reg{SDR_REGS_NUM}; reg-- > 0;) {
+        if (reg_class_table[reg] == reg_class) {
+            regs[_num++] = reg;
+        }
+    }
+    return _num;
+}
+
+// A synthesizer group is rewritten as: changed config, then the whole
+// frequency word (the write of its last byte starts the VCO calibration),
+// then a poll on the lock bit.
+static uint32_t __emit_synth(spi_script_t& script, const sdr_profile_t* from, const sdr_profile_t* to, uint8_t cfg_class, uint8_t word_class, uint32_t lock_reg, uint8_t lock_mask, bool bbpll) {
+    uint32_t _regs[SDR_REGS_NUM];
+
+    auto _cfg_num{__collect(from, to, cfg_class, _regs)};
+    __emit(script, to, _regs, _cfg_num);
+
+    auto _word_num{__collect(from, to, word_class, _regs)};
+
+    if (_cfg_num + _word_num > 0) {
+        __emit(script, to, _regs, __collect_all(word_class, _regs));
+
+        if (bbpll) {
+            // NOTE: the BBPLL needs an explicit reset to lock on the new word
+            __emit_byte(script, REG_SDM_CTRL_1, INIT_BB_FO_CAL | BBPLL_RESET_BAR);
+            __emit_byte(script, REG_SDM_CTRL_1, BBPLL_RESET_BAR);
+        }
+        SPI_SCRIPT_Poll(script, lock_reg, lock_mask, 1, 120);
+    }
+    return _cfg_num + _word_num;
+}
+
+// Collects the clock sources whose dividers, scalers or PLL words differ
+// between images: their memoized rates are stale once the delta is applied.
+static uint32_t __clocks(const sdr_profile_t* from, const sdr_profile_t* to) {
+    static const struct {
+        uint32_t reg;
+        uint32_t sources;
+    } _map[]{
+        {REG_CLOCK_CTRL, 1U << BB_REFCLK},
+        {REG_REF_DIVIDE_CONFIG_1, 1U << RX_REFCLK},
+        {REG_REF_DIVIDE_CONFIG_2, 1U << RX_REFCLK | 1U << TX_REFCLK},
+        {REG_BBPLL, 1U << ADC_CLK | 1U << DAC_CLK},
+        {REG_RX_ENABLE_FILTER_CTRL, 1U << R2_CLK | 1U << R1_CLK | 1U << CLKRF_CLK | 1U << RX_SAMPL_CLK},
+        {REG_TX_ENABLE_FILTER_CTRL, 1U << T2_CLK | 1U << T1_CLK | 1U << CLKTF_CLK | 1U << TX_SAMPL_CLK},
+    };
+
+    static const struct {
+        uint8_t  reg_class;
+        uint32_t source;
+    } _pll[]{
+        {REG_CLASS_BBPLL_WORD, BBPLL_CLK},
+        {REG_CLASS_BBPLL_CFG, BBPLL_CLK},
+        {REG_CLASS_RX_SYNTH_WORD, RX_RFPLL},
+        {REG_CLASS_RX_SYNTH_CFG, RX_RFPLL},
+        {REG_CLASS_TX_SYNTH_WORD, TX_RFPLL},
+        {REG_CLASS_TX_SYNTH_CFG, TX_RFPLL},
+    };
+
+    uint32_t _clocks{0};
+
+    for (const auto& _entry : _map) {
+        if (from->image.regs[_entry.reg] != to->image.regs[_entry.reg]) {
+            _clocks |= _entry.sources;
+        }
+    }
+
+    for (uint32_t reg{0}; reg < SDR_REGS_NUM; ++reg) {
+        if (from->image.regs[reg] != to->image.regs[reg]) {
+            for (const auto& _entry : _pll) {
+                if (reg_class_table[reg] == _entry.reg_class) {
+                    _clocks |= 1U << _entry.source;
+                }
+            }
+        }
+    }
+    return _clocks;
+}
+
+// Brings the driver state in line with the registers rewritten by a delta:
+// stale clock rates are recalculated, and so are the LO frequencies.
+static void __resync(uint8_t id, uint32_t clocks) {
+    auto* _phy{&ad9361_phy[id]};
+
+    for (int32_t source{0}; source < NUM_AD9361_CLKS; ++source) {
+        if (clocks & (1U << source)) {
+            clk_cache_invalidate(_phy, source);
+        }
+    }
+
+    clk_recalc_rates(_phy);
+
+    _phy->pdata.rx_synth_freq = ad9361_from_clk(_phy->clks[RX_RFPLL].rate);
+    _phy->pdata.tx_synth_freq = ad9361_from_clk(_phy->clks[TX_RFPLL].rate);
+}
+
+// SECTION: public API
+
+bool PROFILE_Capture(uint8_t id, sdr_profile_t* profile) {
+    if (profile == nullptr) {
+        LOG_FORMAT(error, "Invalid profile (%s)", __func__);
+        return false;
+    }
+
+    profile->valid = SDR_Snapshot(id, &profile->image);
+
+    if (!profile->valid) {
+        LOG_FORMAT(error, "Capture failure (%s)", __func__);
+    }
+    return profile->valid;
+}
+
+bool PROFILE_Diff(const sdr_profile_t* from, const sdr_profile_t* to, sdr_profile_delta_t* delta) {
+    if (from == nullptr || to == nullptr || delta == nullptr || !from->valid || !to->valid) {
+        LOG_FORMAT(error, "Invalid profile (%s)", __func__);
+        return false;
+    }
+
+    uint32_t _regs[SDR_REGS_NUM];
+    uint32_t _changes{0};
+    auto&    _script{delta->script};
+
+    delta->from    = from;
+    delta->to      = to;
+    delta->changes = 0;
+    delta->clocks  = __clocks(from, to);
+    _script.clear();
+
+    // NOTE: the ENSM is parked in ALERT while the clocks and synthesizers move
+    __emit_byte(_script, REG_ENSM_CONFIG_1, TO_ALERT | FORCE_ALERT_STATE);
+
+    _changes += __emit_synth(_script, from, to, REG_CLASS_BBPLL_CFG, REG_CLASS_BBPLL_WORD, REG_CH_1_OVERFLOW, BBPLL_LOCK, true);
+
+    auto _num{__collect(from, to, REG_CLASS_PLAIN, _regs)};
+    __emit(_script, to, _regs, _num);
+    _changes += _num;
+
+    _changes += __emit_synth(_script, from, to, REG_CLASS_RX_SYNTH_CFG, REG_CLASS_RX_SYNTH_WORD, REG_RX_CP_OVERRANGE_VCO_LOCK, VCO_LOCK, false);
+    _changes += __emit_synth(_script, from, to, REG_CLASS_TX_SYNTH_CFG, REG_CLASS_TX_SYNTH_WORD, REG_TX_CP_OVERRANGE_VCO_LOCK, VCO_LOCK, false);
+
+    _num = __collect(from, to, REG_CLASS_ENSM, _regs);
+    _changes += _num;
+
+    if (_changes == 0) {
+        _script.clear();
+    }
+    else {
+        __emit_byte(_script, REG_ENSM_CONFIG_2, to->image.regs[REG_ENSM_CONFIG_2]);
+        __emit_byte(_script, REG_ENSM_MODE, to->image.regs[REG_ENSM_MODE]);
+        __emit_byte(_script, REG_ENSM_CONFIG_1, to->image.regs[REG_ENSM_CONFIG_1]);
+    }
+
+    delta->changes = _changes;
+    return true;
+}
+
+bool PROFILE_Apply(uint8_t id, const sdr_profile_delta_t* delta) {
+    if (id >= SPI_SDR_NUM || delta == nullptr) {
+        LOG_FORMAT(error, "Invalid arguments (%s)", __func__);
+        return false;
+    }
+
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+    if (delta->changes == 0) {
+        return true;
+    }
+
+    if (!SPI_SDR_Execute(id, delta->script.data(), delta->script.size())) {
+        LOG_FORMAT(error, "Delta failure [from: %u, to: %u] (%s)", delta->from->id, delta->to->id, __func__);
+        return false;
+    }
+
+    __resync(id, delta->clocks);
+
+    LOG_FORMAT(debug, "Delta applied [from: %u, to: %u, changes: %u, bytes: %lu] (%s)", delta->from->id, delta->to->id, delta->changes, delta->script.size(), __func__);
+    return true;
+}
+
+bool PROFILE_Switch(uint8_t id, const sdr_profile_t* to) {
+    if (id >= SPI_SDR_NUM || to == nullptr || !to->valid) {
+        LOG_FORMAT(error, "Invalid arguments (%s)", __func__);
+        return false;
+    }
+
+    // NOTE: the capture, the diff and the delta are one bus sequence
+    spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+    auto* _from{profile_current[id]};
+
+    if (_from == to) {
+        return true;
+    }
+
+    sdr_profile_delta_t* _delta{nullptr};
+
+    if (_from == nullptr) {
+        // NOTE: unknown starting point, the live image is diffed (not cached)
+        if (!PROFILE_Capture(id, &profile_live[id])) {
+            return false;
+        }
+        _from = &profile_live[id];
+    }
+    else {
+        for (auto& _entry : profile_cache[id]) {
+            if (_entry.from == _from && _entry.to == to) {
+                _delta = &_entry;
+                break;
+            }
+        }
+    }
+
+    if (_delta == nullptr) {
+        _delta = &profile_cache[id][profile_cache_next[id]];
+
+        if (_from != &profile_live[id]) {
+            profile_cache_next[id] = (profile_cache_next[id] + 1) % PROFILE_CACHE_NUM;
+        }
+
+        if (!PROFILE_Diff(_from, to, _delta)) {
+            return false;
+        }
+    }
+
+    auto _ret{PROFILE_Apply(id, _delta)};
+
+    if (_from == &profile_live[id]) {
+        // NOTE: the scratch slot must never be matched as a cached entry
+        _delta->from = nullptr;
+        _delta->to   = nullptr;
+    }
+
+    profile_current[id] = _ret ? to : nullptr;
+    return _ret;
+}
+
+// Drops the switch state of a module: to be called whenever its registers are
+// written outside PROFILE_Switch (e.g. SDR_Configure or a gain change).
+void PROFILE_Forget(uint8_t id) {
+    if (id < SPI_SDR_NUM) {
+        spi_bus_lock_t _bus(SPI_SDR_Bus());
+
+        profile_current[id]    = nullptr;
+        profile_cache_next[id] = 0;
+
+        for (auto& _entry : profile_cache[id]) {
+            _entry.from    = nullptr;
+            _entry.to      = nullptr;
+            _entry.changes = 0;
+            _entry.clocks  = 0;
+            _entry.script.clear();
+        }
+    }
+}
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      sdr_profile.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDR_PROFILE_HPP
+#define SDR_PROFILE_HPP
+
+#include "sdr_if.hpp" // sdr_snapshot_t
+#include "spi_if.hpp" // spi_script_t
+
+#include <cstdint> // uint8_t, uint32_t
+
+typedef struct sdr_profile {
+    uint32_t       id;
+    bool           valid;
+    sdr_snapshot_t image;
+} sdr_profile_t;
+
+typedef struct sdr_profile_delta {
+    const sdr_profile_t* from;
+    const sdr_profile_t* to;
+    uint32_t             changes;
+    uint32_t             clocks; // NOTE: rewritten clock sources, one bit each
+    spi_script_t         script;
+} sdr_profile_delta_t;
+
+bool PROFILE_Capture(uint8_t id, sdr_profile_t* profile);
+
+bool PROFILE_Diff(const sdr_profile_t* from, const sdr_profile_t* to, sdr_profile_delta_t* delta);
+
+bool PROFILE_Apply(uint8_t id, const sdr_profile_delta_t* delta);
+
+bool PROFILE_Switch(uint8_t id, const sdr_profile_t* to);
+
+void PROFILE_Forget(uint8_t id);
+
+#endif // SDR_PROFILE_HPP
@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      sdr_telemetry.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sdr_telemetry.hpp"
+
+#include "GLogger.hpp"
+
+#include <atomic>  // atomic, atomic_thread_fence
+#include <cstdlib> // atexit
+#include <cstring> // memcpy, memset
+#include <ctime>   // clock_gettime, clock_nanosleep
+#include <thread>  // thread
+
+// SECTION: sample ring
+
+#define TELEM_SAMPLE_WORDS (sizeof(telem_sample_t) / sizeof(uint64_t))
+
+static_assert(sizeof(telem_sample_t) % sizeof(uint64_t) == 0);
+static_assert((TELEM_RING_SIZE & (TELEM_RING_SIZE - 1)) == 0);
+
+// Every slot is a seqlock: the version is odd while the sampler writes it.
+// Payload words are atomics too, so a torn read is detected, never undefined.
+typedef struct telem_slot {
+    std::atomic<uint64_t> version;
+    std::atomic<uint64_t> words[TELEM_SAMPLE_WORDS];
+} telem_slot_t;
+
+static telem_slot_t          telem_ring[TELEM_RING_SIZE];
+static std::atomic<uint64_t> telem_count{0};
+static std::atomic<bool>     telem_quit{false};
+static std::thread           telem_thread;
+static telem_config_t        telem_config;
+static bool                  telem_arbiter{false}; // NOTE: the arbiter was started by TELEM_Start
+
+static void __store(const telem_sample_t* sample) {
+    uint64_t _words[TELEM_SAMPLE_WORDS];
+    memcpy(_words, sample, sizeof(_words));
+
+    auto& _slot{telem_ring[sample->seq & (TELEM_RING_SIZE - 1)]};
+    auto  _version{_slot.version.load(std::memory_order_relaxed)};
+
+    _slot.version.store(_version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i{0}; i < TELEM_SAMPLE_WORDS; ++i) {
+        _slot.words[i].store(_words[i], std::memory_order_relaxed);
+    }
+
+    _slot.version.store(_version + 2, std::memory_order_release);
+    telem_count.store(sample->seq + 1, std::memory_order_release);
+}
+
+static bool __load(uint64_t seq, telem_sample_t* sample) {
+    uint64_t _words[TELEM_SAMPLE_WORDS];
+
+    auto& _slot{telem_ring[seq & (TELEM_RING_SIZE - 1)]};
+
+    while (true) {
+        auto _before{_slot.version.load(std::memory_order_acquire)};
+
+        if (_before & 1) {
+            continue;
+        }
+
+        for (size_t i{0}; i < TELEM_SAMPLE_WORDS; ++i) {
+            _words[i] = _slot.words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (_slot.version.load(std::memory_order_relaxed) == _before) {
+            break;
+        }
+    }
+
+    memcpy(sample, _words, sizeof(_words));
+
+    // NOTE: the slot may already hold a newer lap of the ring
+    return sample->seq == seq;
+}
+
+// SECTION: sampler
+
+static uint64_t __now_ns() {
+    struct timespec _ts;
+    clock_gettime(CLOCK_MONOTONIC, &_ts);
+    return (uint64_t)_ts.tv_sec * 1000000000ULL + (uint64_t)_ts.tv_nsec;
+}
+
+static void __sampler() {
+    const uint64_t _period{(uint64_t)telem_config.period_us * 1000ULL};
+
+    spi_request_t _request{{}, false};
+
+    for (uint32_t r{0}; r < telem_config.ranges_num; ++r) {
+        _request.xfers.push_back({telem_config.id, false, telem_config.ranges[r].reg, telem_config.ranges[r].len, {0}});
+    }
+
+    telem_sample_t _sample;
+    memset(&_sample, 0, sizeof(_sample));
+
+    auto _deadline{__now_ns()};
+
+    while (!telem_quit.load(std::memory_order_acquire)) {
+        _sample.timestamp_ns = __now_ns();
+
+        auto _result{SPI_ARB_Submit(_request).get()};
+
+        uint32_t _offset{0};
+
+        for (const auto& _xfer : _result.xfers) {
+            memcpy(&_sample.data[_offset], _xfer.buf, _xfer.len);
+            _offset += _xfer.len;
+        }
+        _sample.ok = _result.ok;
+
+        __store(&_sample);
+        _sample.seq++;
+
+        // absolute deadlines: no drift, missed periods are skipped and counted
+        _deadline += _period;
+
+        auto _now{__now_ns()};
+
+        if (_now >= _deadline) {
+            auto _missed{(_now - _deadline) / _period + 1};
+            _sample.overruns += (uint32_t)_missed;
+            _deadline        += _missed * _period;
+        }
+
+        struct timespec _ts;
+        _ts.tv_sec  = (time_t)(_deadline / 1000000000ULL);
+        _ts.tv_nsec = (long)(_deadline % 1000000000ULL);
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &_ts, nullptr);
+    }
+}
+
+// SECTION: public API
+
+bool TELEM_Start(const telem_config_t* config) {
+    static std::atomic<bool> _at_exit{false};
+
+    if (telem_thread.joinable()) {
+        LOG_FORMAT(warning, "Telemetry already running (%s)", __func__);
+        return false;
+    }
+
+    if (config == nullptr || config->period_us == 0 || config->ranges_num == 0 || config->ranges_num > TELEM_RANGES_MAX) {
+        LOG_FORMAT(error, "Invalid telemetry config (%s)", __func__);
+        return false;
+    }
+
+    for (uint32_t r{0}; r < config->ranges_num; ++r) {
+        if (config->ranges[r].len == 0 || config->ranges[r].len > SPI_XFER_MAXLEN) {
+            LOG_FORMAT(error, "Invalid telemetry range [reg: 0x%03X, len: %u] (%s)", config->ranges[r].reg, config->ranges[r].len, __func__);
+            return false;
+        }
+    }
+
+    // NOTE: the sampler shares the bus through the arbiter
+    telem_arbiter = !SPI_ARB_IsRunning();
+
+    if (!SPI_ARB_Start()) {
+        telem_arbiter = false;
+        return false;
+    }
+
+    for (auto& _slot : telem_ring) {
+        _slot.version.store(0, std::memory_order_relaxed);
+    }
+
+    telem_config = *config;
+    telem_count.store(0, std::memory_order_release);
+    telem_quit.store(false, std::memory_order_release);
+    telem_thread = std::thread(__sampler);
+
+    // NOTE: registered after the arbiter one, so the sampler is joined first
+    if (!_at_exit.exchange(true)) {
+        atexit(TELEM_Stop);
+    }
+
+    LOG_FORMAT(info, "Telemetry started [period: %u us, ranges: %u] (%s)", config->period_us, config->ranges_num, __func__);
+    return true;
+}
+
+void TELEM_Stop() {
+    if (telem_thread.joinable()) {
+        telem_quit.store(true, std::memory_order_release);
+        telem_thread.join();
+
+        LOG_FORMAT(info, "Telemetry stopped [samples: %lu] (%s)", TELEM_Count(), __func__);
+    }
+
+    if (telem_arbiter) {
+        telem_arbiter = false;
+        SPI_ARB_Stop();
+    }
+}
+
+uint64_t TELEM_Count() {
+    return telem_count.load(std::memory_order_acquire);
+}
+
+bool TELEM_Latest(telem_sample_t* sample) {
+    auto _count{TELEM_Count()};
+
+    if (sample == nullptr || _count == 0) {
+        return false;
+    }
+    return __load(_count - 1, sample);
+}
+
+bool TELEM_Read(uint64_t seq, telem_sample_t* sample) {
+    if (sample == nullptr || seq >= TELEM_Count()) {
+        return false;
+    }
+    return __load(seq, sample);
+}
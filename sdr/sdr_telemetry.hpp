@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      sdr_telemetry.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDR_TELEMETRY_HPP
+#define SDR_TELEMETRY_HPP
+
+#include "spi_arbiter.hpp" // SPI_XFER_MAXLEN
+
+#include <cstdint> // uint8_t, uint32_t, uint64_t
+
+#define TELEM_RANGES_MAX 6
+#define TELEM_RING_SIZE  256 // power of 2
+
+// A range is read as one burst, from 'reg' downwards ('len' registers)
+typedef struct telem_range {
+    uint32_t reg;
+    uint32_t len;
+} telem_range_t;
+
+const telem_range_t TELEM_TEMPERATURE{0x00E, 1}; // REG_TEMPERATURE
+const telem_range_t TELEM_AUXADC{0x01F, 2};      // REG_AUXADC_LSB ... REG_AUXADC_WORD_MSB
+const telem_range_t TELEM_TX_RSSI{0x06D, 3};     // REG_TX_RSSI_LSB ... REG_TX_RSSI1
+const telem_range_t TELEM_RX_RSSI{0x1AC, 6};     // REG_PREAMBLE_LSB ... REG_RX1_RSSI_SYMBOL
+
+typedef struct telem_config {
+    uint8_t       id;
+    uint32_t      period_us;
+    uint32_t      ranges_num;
+    telem_range_t ranges[TELEM_RANGES_MAX];
+} telem_config_t;
+
+// 'data' holds the ranges back to back, each one in burst (descending) order
+typedef struct telem_sample {
+    uint64_t seq;
+    uint64_t timestamp_ns; // CLOCK_MONOTONIC
+    uint32_t overruns;
+    uint32_t ok;
+    uint8_t  data[TELEM_RANGES_MAX * SPI_XFER_MAXLEN];
+} telem_sample_t;
+
+bool TELEM_Start(const telem_config_t* config);
+
+void TELEM_Stop();
+
+uint64_t TELEM_Count();
+
+bool TELEM_Latest(telem_sample_t* sample);
+
+bool TELEM_Read(uint64_t seq, telem_sample_t* sample);
+
+#endif // SDR_TELEMETRY_HPP
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      spi_arbiter.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "spi_arbiter.hpp"
+
+#include "GLogger.hpp"
+#include "spi_if.hpp"
+
+#include <atomic>  // atomic
+#include <cstdlib> // atexit
+#include <memory>  // make_shared
+#include <mutex>   // recursive_mutex, unique_lock
+#include <thread>  // thread, yield
+
+// SECTION: submission queue
+
+#define SPI_ARB_BATCH_MAX 32
+
+enum { NODE_STUB = 0, NODE_FUTURE, NODE_CALLBACK, NODE_EXEC };
+
+typedef struct spi_node {
+    std::atomic<struct spi_node*> next{nullptr};
+
+    uint8_t                     kind{NODE_STUB};
+    spi_request_t               request;
+    std::promise<spi_request_t> promise;
+    spi_callback_t              callback;
+    std::function<bool()>       func;
+    std::promise<bool>          result;
+} spi_node_t;
+
+// Intrusive MPSC queue (D. Vyukov): producers only exchange the head, the
+// worker is the single consumer of the tail, so no lock is ever taken.
+static spi_node_t               arb_stub;
+static std::atomic<spi_node_t*> arb_head{&arb_stub};
+static spi_node_t*              arb_tail{&arb_stub};
+
+static std::atomic<uint32_t> arb_pending{0};
+static std::atomic<bool>     arb_running{false};
+static std::atomic<bool>     arb_quit{false};
+static std::thread           arb_thread;
+
+static void __push(spi_node_t* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    auto* _prev{arb_head.exchange(node, std::memory_order_acq_rel)};
+    _prev->next.store(node, std::memory_order_release);
+}
+
+static spi_node_t* __pop() {
+    auto* _tail{arb_tail};
+    auto* _next{_tail->next.load(std::memory_order_acquire)};
+
+    if (_tail == &arb_stub) {
+        if (_next == nullptr) {
+            return nullptr;
+        }
+
+        arb_tail = _next;
+        _tail    = _next;
+        _next    = _next->next.load(std::memory_order_acquire);
+    }
+
+    if (_next != nullptr) {
+        arb_tail = _next;
+        return _tail;
+    }
+
+    // NOTE: a producer is between its exchange and its link
+    if (_tail != arb_head.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    __push(&arb_stub);
+
+    _next = _tail->next.load(std::memory_order_acquire);
+
+    if (_next != nullptr) {
+        arb_tail = _next;
+        return _tail;
+    }
+    return nullptr;
+}
+
+static void __enqueue(spi_node_t* node) {
+    if (!arb_running.load(std::memory_order_acquire)) {
+        LOG_FORMAT(error, "SPI arbiter not running (%s)", __func__);
+        node->request.ok = false;
+
+        switch (node->kind) {
+            case NODE_FUTURE:
+                node->promise.set_value(std::move(node->request));
+                break;
+            case NODE_CALLBACK:
+                node->callback(node->request);
+                break;
+            case NODE_EXEC:
+                node->result.set_value(false);
+                break;
+            default:
+                break;
+        }
+        delete node;
+        return;
+    }
+
+    __push(node);
+
+    arb_pending.fetch_add(1, std::memory_order_release);
+    arb_pending.notify_one();
+}
+
+// SECTION: worker
+
+static uint32_t arb_requests;
+static uint32_t arb_xfers;
+static uint32_t arb_bursts;
+
+static void __execute(spi_node_t** batch, uint32_t batch_len) {
+    // NOTE: the batch is one bus sequence, a configuration or a profile switch holding
+    // the bus lock is never interleaved with it
+    std::unique_lock<std::recursive_mutex> _bus(SPI_SDR_Bus());
+
+    uint8_t     _burst[SPI_XFER_MAXLEN];
+    uint8_t     _id{0};
+    uint32_t    _addr{0};
+    uint32_t    _len{0};
+    spi_node_t* _owners[SPI_XFER_MAXLEN];
+    uint32_t    _owners_num{0};
+
+    auto __flush = [&]() {
+        if (_len > 0) {
+            auto _ok{SPI_SDR_WriteM(_id, _addr, _burst, _len)};
+
+            for (decltype(_owners_num) i{0}; i < _owners_num; ++i) {
+                _owners[i]->request.ok &= _ok;
+            }
+            arb_bursts++;
+            _len        = 0;
+            _owners_num = 0;
+        }
+    };
+
+    for (decltype(batch_len) n{0}; n < batch_len; ++n) {
+        auto* _node{batch[n]};
+
+        if (_node->kind == NODE_EXEC) {
+            __flush();
+            _node->request.ok = _node->func();
+            continue;
+        }
+
+        _node->request.ok = true;
+        arb_requests++;
+
+        for (auto& _xfer : _node->request.xfers) {
+            arb_xfers++;
+
+            if (_xfer.len == 0 || _xfer.len > SPI_XFER_MAXLEN) {
+                _node->request.ok = false;
+                continue;
+            }
+
+            if (!_xfer.write) {
+                __flush();
+                _node->request.ok &= SPI_SDR_ReadM(_xfer.id, _xfer.reg, _xfer.buf, _xfer.len);
+                continue;
+            }
+
+            // NOTE: adjacent writes (also from different requests) share a burst
+            for (decltype(_xfer.len) i{0}; i < _xfer.len; ++i) {
+                auto _reg{_xfer.reg - i};
+
+                if (_len == 0 || _len == SPI_XFER_MAXLEN || _xfer.id != _id || _reg != _addr - _len) {
+                    __flush();
+                    _id   = _xfer.id;
+                    _addr = _reg;
+                }
+                _burst[_len++] = _xfer.buf[i];
+
+                if (_owners_num == 0 || _owners[_owners_num - 1] != _node) {
+                    _owners[_owners_num++] = _node;
+                }
+            }
+        }
+    }
+
+    __flush();
+
+    // NOTE: the requesters are released without the bus
+    _bus.unlock();
+
+    for (decltype(batch_len) n{0}; n < batch_len; ++n) {
+        auto* _node{batch[n]};
+
+        switch (_node->kind) {
+            case NODE_FUTURE:
+                _node->promise.set_value(std::move(_node->request));
+                break;
+            case NODE_CALLBACK:
+                _node->callback(_node->request);
+                break;
+            case NODE_EXEC:
+                _node->result.set_value(_node->request.ok);
+                break;
+            default:
+                break;
+        }
+        delete _node;
+    }
+}
+
+static void __worker() {
+    spi_node_t* _batch[SPI_ARB_BATCH_MAX];
+
+    while (true) {
+        arb_pending.wait(0, std::memory_order_acquire);
+
+        uint32_t _len{0};
+
+        while (_len < SPI_ARB_BATCH_MAX) {
+            auto* _node{__pop()};
+
+            if (_node == nullptr) {
+                break;
+            }
+
+            _batch[_len++] = _node;
+        }
+
+        if (_len == 0) {
+            if (arb_quit) {
+                break;
+            }
+
+            std::this_thread::yield();
+            continue;
+        }
+
+        arb_pending.fetch_sub(_len, std::memory_order_acq_rel);
+
+        __execute(_batch, _len);
+    }
+}
+
+// SECTION: public API
+
+bool SPI_ARB_Start() {
+    static std::atomic<bool> _at_exit{false};
+
+    if (arb_running.load(std::memory_order_acquire)) {
+        return true;
+    }
+
+    // NOTE: registered after the static objects are built, so it runs before 'arb_thread' is destroyed
+    if (!_at_exit.exchange(true)) {
+        atexit(SPI_ARB_Stop);
+    }
+
+    arb_quit     = false;
+    arb_requests = 0;
+    arb_xfers    = 0;
+    arb_bursts   = 0;
+
+    arb_running.store(true, std::memory_order_release);
+    arb_thread = std::thread(__worker);
+
+    LOG_FORMAT(info, "SPI arbiter started (%s)", __func__);
+    return true;
+}
+
+// NOTE: must not race with the submitters, pending requests are executed first
+void SPI_ARB_Stop() {
+    if (!arb_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    arb_running.store(false, std::memory_order_release);
+
+    arb_quit = true;
+    arb_pending.fetch_add(1, std::memory_order_release);
+    arb_pending.notify_one();
+
+    if (arb_thread.joinable()) {
+        arb_thread.join();
+    }
+
+    arb_pending.store(0, std::memory_order_release);
+
+    LOG_FORMAT(info, "SPI arbiter stopped [requests: %u, xfers: %u, bursts: %u] (%s)", arb_requests, arb_xfers, arb_bursts, __func__);
+}
+
+bool SPI_ARB_IsRunning() {
+    return arb_running.load(std::memory_order_acquire);
+}
+
+std::future<spi_request_t> SPI_ARB_Submit(spi_request_t request) {
+    auto* _node{new spi_node_t};
+    _node->kind    = NODE_FUTURE;
+    _node->request = std::move(request);
+
+    auto _future{_node->promise.get_future()};
+    __enqueue(_node);
+    return _future;
+}
+
+void SPI_ARB_Submit(spi_request_t request, spi_callback_t callback) {
+    auto* _node{new spi_node_t};
+    _node->kind     = NODE_CALLBACK;
+    _node->request  = std::move(request);
+    _node->callback = std::move(callback);
+
+    __enqueue(_node);
+}
+
+std::future<bool> SPI_ARB_Exec(std::function<bool()> func) {
+    auto* _node{new spi_node_t};
+    _node->kind = NODE_EXEC;
+    _node->func = std::move(func);
+
+    auto _future{_node->result.get_future()};
+    __enqueue(_node);
+    return _future;
+}
+
+std::future<uint8_t> SPI_ARB_Read(uint8_t id, uint32_t reg) {
+    auto _promise{std::make_shared<std::promise<uint8_t>>()};
+    auto _future{_promise->get_future()};
+
+    spi_request_t _request{{{id, false, reg, 1, {0}}}, false};
+
+    SPI_ARB_Submit(std::move(_request), [_promise](spi_request_t& request) {
+        _promise->set_value(request.ok ? request.xfers[0].buf[0] : 0);
+    });
+    return _future;
+}
+
+std::future<bool> SPI_ARB_Write(uint8_t id, uint32_t reg, uint8_t val) {
+    auto _promise{std::make_shared<std::promise<bool>>()};
+    auto _future{_promise->get_future()};
+
+    spi_request_t _request{{{id, true, reg, 1, {val}}}, false};
+
+    SPI_ARB_Submit(std::move(_request), [_promise](spi_request_t& request) {
+        _promise->set_value(request.ok);
+    });
+    return _future;
+}
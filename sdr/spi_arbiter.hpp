@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      spi_arbiter.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPI_ARBITER_HPP
+#define SPI_ARBITER_HPP
+
+#include <cstdint>    // uint8_t, uint32_t
+#include <functional> // function
+#include <future>     // future
+#include <vector>     // vector
+
+#define SPI_XFER_MAXLEN 8
+
+typedef struct spi_xfer {
+    uint8_t  id;
+    bool     write;
+    uint32_t reg;
+    uint32_t len;
+    uint8_t  buf[SPI_XFER_MAXLEN]; // buf[i] is register 'reg - i'
+} spi_xfer_t;
+
+typedef struct spi_request {
+    std::vector<spi_xfer_t> xfers; // executed in order, reads filled in place
+    bool                    ok;
+} spi_request_t;
+
+typedef std::function<void(spi_request_t& request)> spi_callback_t;
+
+// NOTE: a running arbiter is also stopped at exit, its thread is never left joinable
+bool SPI_ARB_Start();
+
+void SPI_ARB_Stop();
+
+bool SPI_ARB_IsRunning();
+
+// NOTE: a batch runs under the bus lock (SPI_SDR_Bus), the direct SPI_SDR_* callers
+// never interleave with it
+std::future<spi_request_t> SPI_ARB_Submit(spi_request_t request);
+
+void SPI_ARB_Submit(spi_request_t request, spi_callback_t callback);
+
+std::future<bool> SPI_ARB_Exec(std::function<bool()> func);
+
+std::future<uint8_t> SPI_ARB_Read(uint8_t id, uint32_t reg);
+
+std::future<bool> SPI_ARB_Write(uint8_t id, uint32_t reg, uint8_t val);
+
+#endif // SPI_ARBITER_HPP
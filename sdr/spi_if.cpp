@@ -16,15 +16,48 @@
 #include "spi_if.hpp"
 
 #include "GAXIQuadSPI.hpp"
+#include "GDefine.hpp"
 #include "GLogger.hpp"
 #include "definitions.hpp"
 #include "sdr_ad9361.hpp"
+#include "spi_sim.hpp"
+#include "stime.hpp"
 
-#include <cstring> // memcpy
+#include <atomic>   // atomic
+#include <cstring>  // memcmp, memcpy
+#include <fstream>  // ifstream, ofstream
+#include <iterator> // istreambuf_iterator
+#include <mutex>    // lock_guard, mutex, recursive_mutex
+#include <thread>   // this_thread, thread
 
 GMAPdevice*  ad9361_regs = nullptr;
 GAXIQuadSPI* ad9361_qspi = nullptr;
 
+static std::recursive_mutex spi_bus_mutex;
+
+// SECTION: transaction recorder
+
+// Script layout: sequence of [opcode][payload] records (files start with 4 bytes magic).
+// All multi-byte fields are little-endian.
+//   SCRIPT_WRITE : reg (2), len (1), data (len) -- data[i] goes to 'reg - i'
+//   SCRIPT_WAIT  : delay [us] (4)
+//   SCRIPT_POLL  : reg (2), mask (1), done_state (1), period [us] (4)
+//   SCRIPT_FPGA  : reg (4), val (4)
+enum { SCRIPT_WRITE = 0x01, SCRIPT_WAIT = 0x02, SCRIPT_POLL = 0x03, SCRIPT_FPGA = 0x04 };
+
+static const uint8_t  SCRIPT_MAGIC[4]{'S', 'P', 'I', '1'};
+static const uint32_t SCRIPT_POLL_TIMEOUT{5000};
+
+// NOTE: only the thread that started the recorder is captured, the other
+// threads may keep using the SPI bus without polluting the script
+static spi_script_t      spi_script;
+static std::mutex        spi_script_mutex;
+static std::thread::id   spi_script_owner;
+static std::atomic<bool> spi_script_on{false};
+
+// NOTE: a depth, so a muted section may run inside another one
+static thread_local unsigned spi_script_mute{0};
+
 uint32_t __ffs(uint32_t word) {
     uint32_t num = 0;
 
@@ -48,6 +81,34 @@ uint32_t __ffs(uint32_t word) {
     return num;
 }
 
+static void __script_put(spi_script_t& script, uint32_t val, uint32_t bytes) {
+    for (decltype(bytes) i{0}; i < bytes; ++i) {
+        script.push_back((uint8_t)(val >> (8 * i)));
+    }
+}
+
+static uint32_t __script_get(const uint8_t* src, uint32_t bytes) {
+    uint32_t val{0};
+
+    for (decltype(bytes) i{0}; i < bytes; ++i) {
+        val |= (uint32_t)src[i] << (8 * i);
+    }
+    return val;
+}
+
+template <typename F>
+static void __script_record(F&& record) {
+    if (spi_script_on.load(std::memory_order_acquire) && spi_script_mute == 0) {
+        std::lock_guard<std::mutex> _lock(spi_script_mutex);
+
+        DO_IF(spi_script_on && spi_script_owner == std::this_thread::get_id(), record(spi_script));
+    }
+}
+
+std::recursive_mutex& SPI_SDR_Bus() {
+    return spi_bus_mutex;
+}
+
 bool SPI_SDR_Init(uint8_t id, bool clock_phase, bool clock_polarity) {
     UNUSED(id);
 
@@ -76,6 +137,14 @@ bool SPI_SDR_Init(uint8_t id, bool clock_phase, bool clock_polarity) {
     return false;
 }
 
+// NOTE: the register-level model replaces the QSPI core and the FPGA registers
+bool SPI_SDR_InitSim(uint8_t id, uint32_t spi_clock_hz) {
+    UNUSED(id);
+
+    SIM_Init(spi_clock_hz);
+    return true;
+}
+
 uint8_t SPI_SDR_Read(uint8_t id, uint32_t reg, bool* error) {
     auto    _ret{true};
     uint8_t _buf{0};
@@ -116,6 +185,12 @@ _exit:
 bool SPI_SDR_ReadM(uint8_t id, uint32_t reg, uint8_t* rx_buf, uint32_t rx_buf_len) {
     UNUSED(id);
 
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
+    if (rx_buf != nullptr && SIM_IsActive()) {
+        return SIM_ReadM(reg, rx_buf, rx_buf_len);
+    }
+
     if (rx_buf != nullptr && ad9361_qspi != nullptr) {
         uint16_t cmd = AD_READ | AD_CNT(rx_buf_len) | AD_ADDR(reg);
 
@@ -152,6 +227,9 @@ bool SPI_SDR_WriteF(uint8_t id, uint32_t reg, uint8_t mask, uint8_t val) {
 
     uint8_t _buf;
 
+    // NOTE: read-modify-write, one bus transaction for the other threads
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
     if (!SPI_SDR_ReadM(id, reg, &_buf, 1)) {
         LOG_FORMAT(error, "Read Error [reg: 0x%04X] (%s)", reg, __func__);
         return false;
@@ -166,21 +244,30 @@ bool SPI_SDR_WriteF(uint8_t id, uint32_t reg, uint8_t mask, uint8_t val) {
 bool SPI_SDR_WriteM(uint8_t id, uint32_t reg, uint8_t* tx_buf, uint32_t tx_buf_len) {
     UNUSED(id);
 
-    if (tx_buf != nullptr && ad9361_qspi != nullptr) {
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
+    if (tx_buf != nullptr && (ad9361_qspi != nullptr || SIM_IsActive())) {
         if (tx_buf_len > MAX_MBYTE_SPI) {
             LOG_FORMAT(error, "Writing Capacity overcoming [num > max: %d > %d] (%s)", tx_buf_len, MAX_MBYTE_SPI, __func__);
             return false;
         }
 
-        uint16_t cmd = AD_WRITE | AD_CNT(tx_buf_len) | AD_ADDR(reg);
+        if (SIM_IsActive()) {
+            SIM_WriteM(reg, tx_buf, tx_buf_len);
+        }
+        else {
+            uint16_t cmd = AD_WRITE | AD_CNT(tx_buf_len) | AD_ADDR(reg);
 
-        uint8_t _buf[2 + MAX_MBYTE_SPI];
-        _buf[0] = cmd >> 8;
-        _buf[1] = cmd & 0xFF;
+            uint8_t _buf[2 + MAX_MBYTE_SPI];
+            _buf[0] = cmd >> 8;
+            _buf[1] = cmd & 0xFF;
+
+            memcpy(&_buf[2], tx_buf, tx_buf_len);
 
-        memcpy(&_buf[2], tx_buf, tx_buf_len);
+            ad9361_qspi->WriteThenRead(_buf, 2 + tx_buf_len, nullptr, 0);
+        }
 
-        ad9361_qspi->WriteThenRead(_buf, 2 + tx_buf_len, nullptr, 0);
+        __script_record([&](spi_script_t& script) { SPI_SCRIPT_Write(script, reg, tx_buf, tx_buf_len); });
         return true;
     }
 
@@ -191,19 +278,34 @@ bool SPI_SDR_WriteM(uint8_t id, uint32_t reg, uint8_t* tx_buf, uint32_t tx_buf_l
 bool SPI_FPGA_Write(uint32_t reg, uint32_t val) {
     auto _ret{false};
 
-    if (ad9361_regs->Open()) {
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
+    if (SIM_IsActive()) {
+        _ret = SIM_FpgaWrite(reg, val);
+    }
+    else if (ad9361_regs->Open()) {
         if (ad9361_regs->MapToMemory()) { _ret = ad9361_regs->Write(reg, &val); }
         ad9361_regs->Close();
     }
+
+    if (_ret) {
+        __script_record([&](spi_script_t& script) { SPI_SCRIPT_Fpga(script, reg, val); });
+    }
     return _ret;
 }
 
 uint32_t SPI_FPGA_Read(uint32_t reg, bool* error) {
     auto _ret{false};
 
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
     uint32_t _buf{0};
 
-    if (ad9361_regs->Open()) {
+    if (SIM_IsActive()) {
+        _buf = SIM_FpgaRead(reg);
+        _ret = true;
+    }
+    else if (ad9361_regs->Open()) {
         if (ad9361_regs->MapToMemory()) { _ret = ad9361_regs->Read(reg, &_buf, 1); }
         ad9361_regs->Close();
     }
@@ -211,3 +313,248 @@ uint32_t SPI_FPGA_Read(uint32_t reg, bool* error) {
     if (error != nullptr) { *error = _ret; }
     return _buf;
 }
+
+void SPI_SCRIPT_Write(spi_script_t& script, uint32_t reg, const uint8_t* buf, uint32_t len) {
+    script.push_back(SCRIPT_WRITE);
+    __script_put(script, AD_ADDR(reg), 2);
+    __script_put(script, len, 1);
+    script.insert(script.end(), buf, buf + len);
+}
+
+void SPI_SCRIPT_Wait(spi_script_t& script, unsigned long delay) {
+    script.push_back(SCRIPT_WAIT);
+    __script_put(script, (uint32_t)delay, 4);
+}
+
+void SPI_SCRIPT_Poll(spi_script_t& script, uint32_t reg, uint8_t mask, uint8_t done_state, unsigned long period) {
+    script.push_back(SCRIPT_POLL);
+    __script_put(script, AD_ADDR(reg), 2);
+    __script_put(script, mask, 1);
+    __script_put(script, done_state, 1);
+    __script_put(script, (uint32_t)period, 4);
+}
+
+void SPI_SCRIPT_Fpga(spi_script_t& script, uint32_t reg, uint32_t val) {
+    script.push_back(SCRIPT_FPGA);
+    __script_put(script, reg, 4);
+    __script_put(script, val, 4);
+}
+
+bool SPI_SDR_Execute(uint8_t id, const uint8_t* script, size_t script_len) {
+    uint8_t  _burst[MAX_MBYTE_SPI];
+    uint32_t _addr{0};
+    uint32_t _len{0};
+    uint32_t _wait{0};
+    uint32_t _bursts{0};
+    uint32_t _writes{0};
+    uint32_t _dropped{0};
+    auto     _error{script == nullptr};
+
+    const auto* _ptr{script};
+    const auto* _end{script + script_len};
+
+    auto __flush = [&]() {
+        if (_len > 0) {
+            _error |= !SPI_SDR_WriteM(id, _addr, _burst, _len);
+            _bursts++;
+            _len = 0;
+        }
+    };
+
+    auto __sleep = [&]() {
+        if (_wait > 0) {
+            STIME_uSleep(_wait);
+            _wait = 0;
+        }
+    };
+
+    spi_bus_lock_t _bus(spi_bus_mutex);
+
+    SPI_SDR_RecordMute(true);
+
+    while (!_error && _ptr < _end) {
+        auto _op{*_ptr++};
+
+        switch (_op) {
+            case SCRIPT_WRITE: {
+                _error = (_end - _ptr) < 3;
+                BREAK_IF(_error, );
+
+                auto _reg{__script_get(_ptr, 2)};
+                auto _num{__script_get(_ptr + 2, 1)};
+                _ptr += 3;
+
+                _error = (_num == 0) || (_num > MAX_MBYTE_SPI) || ((uint32_t)(_end - _ptr) < _num);
+                BREAK_IF(_error, );
+
+                __sleep();
+
+                // NOTE: multi-byte transfers walk the register map downwards
+                for (decltype(_num) i{0}; i < _num; ++i) {
+                    auto _next{_reg - i};
+
+                    if (_len == 0 || _len == MAX_MBYTE_SPI || _next != _addr - _len) {
+                        __flush();
+                        _addr = _next;
+                    }
+                    _burst[_len++] = _ptr[i];
+                }
+                _ptr += _num;
+                _writes++;
+            } break;
+
+            case SCRIPT_WAIT: {
+                _error = (_end - _ptr) < 4;
+                BREAK_IF(_error, );
+
+                __flush();
+                _wait += __script_get(_ptr, 4);
+                _ptr  += 4;
+            } break;
+
+            case SCRIPT_POLL: {
+                _error = (_end - _ptr) < 8;
+                BREAK_IF(_error, );
+
+                auto _reg{__script_get(_ptr, 2)};
+                auto _mask{(uint8_t)__script_get(_ptr + 2, 1)};
+                auto _done{__script_get(_ptr + 3, 1)};
+                auto _period{__script_get(_ptr + 4, 4)};
+                _ptr += 8;
+
+                __flush();
+
+                // NOTE: the poll itself waits for completion, a preceding wait is redundant
+                _dropped += (_wait > 0);
+                _wait     = 0;
+
+                auto _timeout{SCRIPT_POLL_TIMEOUT};
+
+                while (SPI_SDR_ReadF(id, _reg, _mask) != _done && _timeout-- > 0) {
+                    STIME_uSleep(_period);
+                }
+
+                // NOTE: the device did not reach the recorded state, the replay is not trustworthy
+                if (_timeout == UINT32_MAX) {
+                    LOG_FORMAT(error, "Poll timeout [reg 0x%X, mask 0x%X] (%s)", _reg, _mask, __func__);
+                    _error = true;
+                }
+            } break;
+
+            case SCRIPT_FPGA: {
+                _error = (_end - _ptr) < 8;
+                BREAK_IF(_error, );
+
+                __flush();
+                __sleep();
+
+                _error = !SPI_FPGA_Write(__script_get(_ptr, 4), __script_get(_ptr + 4, 4));
+                _ptr  += 8;
+            } break;
+
+            default:
+                _error = true;
+                break;
+        }
+    }
+
+    if (!_error) {
+        __flush();
+        __sleep();
+    }
+
+    SPI_SDR_RecordMute(false);
+
+    if (_error) {
+        LOG_FORMAT(error, "SPI script failure @ offset %ld (%s)", (long)(_ptr - script), __func__);
+        return false;
+    }
+
+    LOG_FORMAT(debug, "SPI script executed [writes: %u, bursts: %u, dropped waits: %u] (%s)", _writes, _bursts, _dropped, __func__);
+    return true;
+}
+
+void SPI_SDR_RecordStart() {
+    std::lock_guard<std::mutex> _lock(spi_script_mutex);
+
+    spi_script.assign(SCRIPT_MAGIC, SCRIPT_MAGIC + sizeof(SCRIPT_MAGIC));
+    spi_script_owner = std::this_thread::get_id();
+    spi_script_on.store(true, std::memory_order_release);
+
+    LOG_FORMAT(info, "SPI recorder started (%s)", __func__);
+}
+
+bool SPI_SDR_RecordStop(const char* filename) {
+    std::lock_guard<std::mutex> _lock(spi_script_mutex);
+
+    auto _ret{false};
+
+    if (spi_script_on.exchange(false, std::memory_order_acq_rel)) {
+
+        if (filename != nullptr) {
+            std::ofstream ofs;
+            ofs.open(filename, std::ios::binary);
+
+            if (ofs.is_open()) {
+                ofs.write((char*)spi_script.data(), (std::streamsize)spi_script.size());
+                _ret = ofs.good();
+                ofs.close();
+            }
+
+            if (_ret) {
+                LOG_FORMAT(info, "SPI script saved [file: %s, bytes: %lu] (%s)", filename, spi_script.size(), __func__);
+            }
+            else {
+                LOG_FORMAT(error, "SPI script failure [file: %s] (%s)", filename, __func__);
+            }
+        }
+    }
+
+    spi_script.clear();
+    spi_script.shrink_to_fit();
+    spi_script_owner = {};
+    return _ret;
+}
+
+void SPI_SDR_RecordMute(bool mute) {
+    if (mute) {
+        spi_script_mute++;
+    }
+    else if (spi_script_mute > 0) {
+        spi_script_mute--;
+    }
+}
+
+void SPI_SDR_RecordWait(unsigned long delay) {
+    __script_record([&](spi_script_t& script) { SPI_SCRIPT_Wait(script, delay); });
+}
+
+void SPI_SDR_RecordPoll(uint32_t reg, uint8_t mask, uint8_t done_state, unsigned long period) {
+    __script_record([&](spi_script_t& script) { SPI_SCRIPT_Poll(script, reg, mask, done_state, period); });
+}
+
+bool SPI_SDR_Replay(uint8_t id, const char* filename) {
+    std::ifstream ifs;
+    ifs.open(filename, std::ios::binary);
+
+    if (!ifs.is_open()) {
+        LOG_FORMAT(error, "SPI script not found [file: %s] (%s)", filename, __func__);
+        return false;
+    }
+
+    spi_script_t _script((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+
+    if (_script.size() < sizeof(SCRIPT_MAGIC) || memcmp(_script.data(), SCRIPT_MAGIC, sizeof(SCRIPT_MAGIC)) != 0) {
+        LOG_FORMAT(error, "SPI script not valid [file: %s] (%s)", filename, __func__);
+        return false;
+    }
+
+    if (!SPI_SDR_Execute(id, _script.data() + sizeof(SCRIPT_MAGIC), _script.size() - sizeof(SCRIPT_MAGIC))) {
+        LOG_FORMAT(error, "SPI script failure [file: %s] (%s)", filename, __func__);
+        return false;
+    }
+
+    LOG_FORMAT(info, "SPI script replayed [file: %s] (%s)", filename, __func__);
+    return true;
+}
@@ -10,10 +10,24 @@
 #ifndef SPI_IF_HPP
 #define SPI_IF_HPP
 
+#include <cstddef> // size_t
 #include <cstdint> // uint8_t, uint32_t
+#include <mutex>   // lock_guard, recursive_mutex
+#include <vector>  // vector
+
+typedef std::vector<uint8_t> spi_script_t;
+
+typedef std::lock_guard<std::recursive_mutex> spi_bus_lock_t;
+
+// NOTE: the bus lock is recursive and every transaction takes it. A sequence that
+// must not be interleaved (configuration, calibration, profile switch) holds it
+// across its transactions, the SPI arbiter holds it for a whole batch.
+std::recursive_mutex& SPI_SDR_Bus();
 
 bool SPI_SDR_Init(uint8_t id, bool clock_phase, bool clock_polarity);
 
+bool SPI_SDR_InitSim(uint8_t id, uint32_t spi_clock_hz = 10000000);
+
 uint8_t SPI_SDR_Read(uint8_t id, uint32_t reg, bool* error = nullptr);
 
 uint8_t SPI_SDR_ReadF(uint8_t id, uint32_t reg, uint8_t mask, bool* error = nullptr);
@@ -30,4 +44,31 @@ bool SPI_FPGA_Write(uint32_t reg, uint32_t val);
 
 uint32_t SPI_FPGA_Read(uint32_t reg, bool* error = nullptr);
 
+// SECTION: transaction recorder
+
+void SPI_SDR_RecordStart();
+
+bool SPI_SDR_RecordStop(const char* filename);
+
+// NOTE: calls nest, every 'true' must be paired with a 'false'
+void SPI_SDR_RecordMute(bool mute);
+
+void SPI_SDR_RecordWait(unsigned long delay);
+
+void SPI_SDR_RecordPoll(uint32_t reg, uint8_t mask, uint8_t done_state, unsigned long period);
+
+bool SPI_SDR_Replay(uint8_t id, const char* filename);
+
+// SECTION: script builder
+
+void SPI_SCRIPT_Write(spi_script_t& script, uint32_t reg, const uint8_t* buf, uint32_t len);
+
+void SPI_SCRIPT_Wait(spi_script_t& script, unsigned long delay);
+
+void SPI_SCRIPT_Poll(spi_script_t& script, uint32_t reg, uint8_t mask, uint8_t done_state, unsigned long period);
+
+void SPI_SCRIPT_Fpga(spi_script_t& script, uint32_t reg, uint32_t val);
+
+bool SPI_SDR_Execute(uint8_t id, const uint8_t* script, size_t script_len);
+
 #endif // SPI_IF_HPP
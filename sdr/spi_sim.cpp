@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      spi_sim.cpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#include "spi_sim.hpp"
+
+#include "GLogger.hpp"
+#include "sdr_ad9361.hpp" // REG_*, AD_ADDR, MAX_MBYTE_SPI
+
+#include <cstring> // memset
+#include <mutex>   // mutex, lock_guard
+#include <utility> // move
+#include <vector>  // vector
+
+// SECTION: device model
+
+#define SIM_REGS_NUM  0x400
+#define SIM_FIR_TAPS  128
+#define SIM_FPGA_REGS 1024
+
+typedef struct sim_event {
+    uint64_t due_ns; // simulated time of the status change
+    uint32_t reg;
+    uint8_t  mask;
+    bool     set;
+} sim_event_t;
+
+typedef struct sim_fir {
+    int16_t coef[2][SIM_FIR_TAPS]; // channel 1 and 2
+    uint8_t select;                // FIR_SELECT of the last configuration
+} sim_fir_t;
+
+// Reset values which differ from zero and matter to the driver
+static const struct {
+    uint32_t reg;
+    uint8_t  val;
+} sim_reset_values[]{
+    {REG_PRODUCT_ID, PRODUCT_ID_9361 | 0x02},             // revision 2
+    {REG_QUAD_CAL_STATUS_TX1, TX1_LO_CONV | TX1_SSB_CONV}, // converged
+    {REG_QUAD_CAL_STATUS_TX2, TX2_LO_CONV | TX2_SSB_CONV}, // converged
+};
+
+// Modelled duration of each REG_CALIBRATION_CTRL self-clearing bit [us]
+static const uint32_t sim_cal_latency_us[8]{
+    800,  // BBDC_CAL
+    2500, // RFDC_CAL
+    500,  // TXMON_CAL
+    1500, // RX_GAIN_STEP_CAL
+    2000, // TX_QUAD_CAL
+    2000, // RX_QUAD_CAL
+    400,  // TX_BB_TUNE_CAL
+    400,  // RX_BB_TUNE_CAL
+};
+
+// Results of a typical RX baseband filter tune (read back by the TIA and ADC setup)
+static const struct {
+    uint32_t reg;
+    uint8_t  val;
+} sim_rx_tune_values[]{
+    {REG_RX_BBF_R2346, 0x2E},
+    {REG_RX_BBF_C3_MSB, 0x14},
+    {REG_RX_BBF_C3_LSB, 0x0A},
+};
+
+#define SIM_PLL_LOCK_US 300 // BBPLL and RF VCO lock time
+#define SIM_CP_CAL_US   250 // RF charge-pump calibration time
+
+static bool                     sim_active{false};
+static uint32_t                 sim_clock_hz;
+static uint8_t                  sim_regs[SIM_REGS_NUM];
+static uint32_t                 sim_fpga[SIM_FPGA_REGS];
+static sim_fir_t                sim_fir[2]; // TX and RX
+static uint64_t                 sim_now_ns;
+static std::vector<sim_event_t> sim_events;
+static sim_stats_t              sim_stats;
+static sim_stats_t              sim_stats_mark;
+
+// NOTE: the trace has its own lock, it must catch the callers that skip the bus lock
+static std::mutex                   sim_trace_mutex;
+static bool                         sim_trace_on{false};
+static std::vector<std::thread::id> sim_trace;
+
+static void __schedule(uint32_t reg, uint8_t mask, bool set, uint32_t latency_us) {
+    sim_events.push_back({sim_now_ns + latency_us * 1000ULL, reg, mask, set});
+}
+
+static void __advance(uint64_t delta_ns) {
+    sim_now_ns += delta_ns;
+
+    for (auto it{sim_events.begin()}; it != sim_events.end();) {
+        if (it->due_ns <= sim_now_ns) {
+            if (it->set) {
+                sim_regs[it->reg] |= it->mask;
+            }
+            else {
+                sim_regs[it->reg] &= (uint8_t)~it->mask;
+            }
+            it = sim_events.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+// A frame is 16 command bits plus 8 bits per register
+static void __trace() {
+    std::lock_guard<std::mutex> _lock(sim_trace_mutex);
+
+    if (sim_trace_on) {
+        sim_trace.push_back(std::this_thread::get_id());
+    }
+}
+
+static void __bus(uint32_t bytes) {
+    auto _ns{(16ULL + 8ULL * bytes) * 1000000000ULL / sim_clock_hz};
+
+    sim_stats.bus_ns += _ns;
+    __advance(_ns);
+}
+
+static void __ensm(uint8_t val) {
+    auto _state{ENSM_STATE(sim_regs[REG_STATE])};
+    auto _fdd{(bool)(sim_regs[REG_ENSM_MODE] & FDD_MODE)};
+
+    if (val & FORCE_ALERT_STATE) {
+        _state = ENSM_STATE_ALERT;
+    }
+    else if (val & FORCE_TX_ON) {
+        _state = _fdd ? ENSM_STATE_FDD : ENSM_STATE_TX;
+    }
+    else if (val & FORCE_RX_ON) {
+        _state = _fdd ? ENSM_STATE_FDD : ENSM_STATE_RX;
+    }
+    else if (val & TO_ALERT) {
+        _state = ENSM_STATE_ALERT;
+    }
+
+    sim_regs[REG_STATE] = (uint8_t)((sim_regs[REG_STATE] & ~ENSM_STATE(~0)) | _state);
+}
+
+static void __fir(uint32_t offs, uint8_t val) {
+    auto& _fir{sim_fir[offs ? 1 : 0]};
+
+    _fir.select = (val >> 3) & 0x03;
+
+    if (val & FIR_WRITE) {
+        auto _addr{sim_regs[REG_TX_FILTER_COEF_ADDR + offs] % SIM_FIR_TAPS};
+        auto _coef{(int16_t)(sim_regs[REG_TX_FILTER_COEF_WRITE_DATA_1 + offs] | (sim_regs[REG_TX_FILTER_COEF_WRITE_DATA_2 + offs] << 8))};
+
+        if (_fir.select & 1) {
+            _fir.coef[0][_addr] = _coef;
+        }
+        if (_fir.select & 2) {
+            _fir.coef[1][_addr] = _coef;
+        }
+    }
+}
+
+static uint8_t __read(uint32_t reg) {
+    for (uint32_t offs : {0U, (uint32_t)(REG_RX_FILTER_COEF_ADDR - REG_TX_FILTER_COEF_ADDR)}) {
+        if (reg == REG_TX_FILTER_COEF_READ_DATA_1 + offs || reg == REG_TX_FILTER_COEF_READ_DATA_2 + offs) {
+            auto& _fir{sim_fir[offs ? 1 : 0]};
+            auto  _addr{sim_regs[REG_TX_FILTER_COEF_ADDR + offs] % SIM_FIR_TAPS};
+            auto  _coef{(uint16_t)_fir.coef[_fir.select == 2 ? 1 : 0][_addr]};
+
+            return (uint8_t)(reg == REG_TX_FILTER_COEF_READ_DATA_1 + offs ? _coef : _coef >> 8);
+        }
+    }
+    return sim_regs[reg];
+}
+
+static void __write(uint32_t reg, uint8_t val) {
+    const uint32_t _rx_offs{REG_RX_FILTER_COEF_ADDR - REG_TX_FILTER_COEF_ADDR};
+    const uint32_t _tx_offs{REG_TX_CP_CONFIG - REG_RX_CP_CONFIG};
+
+    switch (reg) {
+        // read-only status registers
+        case REG_STATE:
+        case REG_PRODUCT_ID:
+        case REG_CH_1_OVERFLOW:
+        case REG_RX_CAL_STATUS:
+        case REG_RX_CAL_STATUS + _tx_offs:
+        case REG_RX_CP_OVERRANGE_VCO_LOCK:
+        case REG_TX_CP_OVERRANGE_VCO_LOCK:
+            return;
+
+        case REG_SPI_CONF:
+            if (val & (SOFT_RESET | _SOFT_RESET)) {
+                SIM_Reset();
+            }
+            break;
+
+        case REG_CALIBRATION_CTRL:
+            for (uint32_t bit{0}; bit < 8; ++bit) {
+                if (val & (1 << bit)) {
+                    __schedule(reg, (uint8_t)(1 << bit), false, sim_cal_latency_us[bit]);
+                }
+            }
+
+            if (val & RX_BB_TUNE_CAL) {
+                for (const auto& _item : sim_rx_tune_values) {
+                    sim_regs[_item.reg] = _item.val;
+                }
+            }
+            break;
+
+        case REG_ENSM_CONFIG_1:
+            __ensm(val);
+            break;
+
+        case REG_SDM_CTRL_1:
+            sim_regs[REG_CH_1_OVERFLOW] &= (uint8_t)~BBPLL_LOCK;
+            if (val & BBPLL_RESET_BAR) {
+                __schedule(REG_CH_1_OVERFLOW, BBPLL_LOCK, true, SIM_PLL_LOCK_US);
+            }
+            break;
+
+        // the integer word low byte starts the VCO calibration
+        case REG_RX_INTEGER_BYTE_0:
+            sim_regs[REG_RX_CP_OVERRANGE_VCO_LOCK] &= (uint8_t)~VCO_LOCK;
+            __schedule(REG_RX_CP_OVERRANGE_VCO_LOCK, VCO_LOCK, true, SIM_PLL_LOCK_US);
+            break;
+
+        case REG_TX_INTEGER_BYTE_0:
+            sim_regs[REG_TX_CP_OVERRANGE_VCO_LOCK] &= (uint8_t)~VCO_LOCK;
+            __schedule(REG_TX_CP_OVERRANGE_VCO_LOCK, VCO_LOCK, true, SIM_PLL_LOCK_US);
+            break;
+
+        case REG_RX_CP_CONFIG:
+        case REG_RX_CP_CONFIG + _tx_offs:
+            if (val & CP_CAL_ENABLE) {
+                auto _status{REG_RX_CAL_STATUS + (reg - REG_RX_CP_CONFIG)};
+                sim_regs[_status] &= (uint8_t)~CP_CAL_VALID;
+                __schedule(_status, CP_CAL_VALID, true, SIM_CP_CAL_US);
+            }
+            break;
+
+        case REG_TX_FILTER_CONF:
+            sim_regs[reg] = val;
+            __fir(0, val);
+            return;
+
+        case REG_TX_FILTER_CONF + _rx_offs:
+            sim_regs[reg] = val;
+            __fir(_rx_offs, val);
+            return;
+
+        default:
+            break;
+    }
+
+    sim_regs[reg] = val;
+}
+
+// SECTION: public API
+
+void SIM_Init(uint32_t spi_clock_hz) {
+    sim_active   = true;
+    sim_clock_hz = spi_clock_hz > 0 ? spi_clock_hz : 10000000;
+    sim_now_ns   = 0;
+
+    memset(&sim_stats, 0, sizeof(sim_stats));
+    memset(&sim_stats_mark, 0, sizeof(sim_stats_mark));
+    memset(sim_fpga, 0, sizeof(sim_fpga));
+
+    SIM_Reset();
+
+    LOG_FORMAT(info, "SPI simulated device created [clock: %u Hz] (%s)", sim_clock_hz, __func__);
+}
+
+void SIM_Exit() {
+    sim_active = false;
+    sim_events.clear();
+}
+
+bool SIM_IsActive() {
+    return sim_active;
+}
+
+void SIM_Reset() {
+    memset(sim_regs, 0, sizeof(sim_regs));
+    memset(sim_fir, 0, sizeof(sim_fir));
+    sim_events.clear();
+
+    for (const auto& _item : sim_reset_values) {
+        sim_regs[_item.reg] = _item.val;
+    }
+}
+
+// NOTE: like the device, multi-byte transfers walk the register map downwards
+bool SIM_ReadM(uint32_t reg, uint8_t* rx_buf, uint32_t rx_buf_len) {
+    if (rx_buf == nullptr || rx_buf_len == 0 || rx_buf_len > MAX_MBYTE_SPI) {
+        return false;
+    }
+
+    __trace();
+    __bus(rx_buf_len);
+    sim_stats.reads++;
+    sim_stats.read_bytes += rx_buf_len;
+
+    for (uint32_t i{0}; i < rx_buf_len; ++i) {
+        rx_buf[i] = __read(AD_ADDR(reg - i));
+    }
+    return true;
+}
+
+bool SIM_WriteM(uint32_t reg, const uint8_t* tx_buf, uint32_t tx_buf_len) {
+    if (tx_buf == nullptr || tx_buf_len == 0 || tx_buf_len > MAX_MBYTE_SPI) {
+        return false;
+    }
+
+    __trace();
+    __bus(tx_buf_len);
+    sim_stats.writes++;
+    sim_stats.write_bytes += tx_buf_len;
+
+    for (uint32_t i{0}; i < tx_buf_len; ++i) {
+        __write(AD_ADDR(reg - i), tx_buf[i]);
+    }
+    return true;
+}
+
+bool SIM_FpgaWrite(uint32_t reg, uint32_t val) {
+    __trace();
+    sim_stats.fpga_ops++;
+    sim_fpga[(reg / sizeof(uint32_t)) % SIM_FPGA_REGS] = val;
+    return true;
+}
+
+uint32_t SIM_FpgaRead(uint32_t reg) {
+    __trace();
+    sim_stats.fpga_ops++;
+    return sim_fpga[(reg / sizeof(uint32_t)) % SIM_FPGA_REGS];
+}
+
+// NOTE: simulated time only, the caller does not really sleep
+void SIM_Sleep(unsigned long delay) {
+    sim_stats.sleeps++;
+    sim_stats.sleep_us += delay;
+    __advance(delay * 1000ULL);
+}
+
+uint8_t SIM_Peek(uint32_t reg) {
+    return sim_regs[AD_ADDR(reg)];
+}
+
+void SIM_GetStats(sim_stats_t* stats) {
+    if (stats != nullptr) {
+        *stats = sim_stats;
+    }
+}
+
+void SIM_Report(const char* label) {
+    auto _reads{sim_stats.reads - sim_stats_mark.reads};
+    auto _writes{sim_stats.writes - sim_stats_mark.writes};
+    auto _bytes{sim_stats.read_bytes + sim_stats.write_bytes - sim_stats_mark.read_bytes - sim_stats_mark.write_bytes};
+    auto _fpga{sim_stats.fpga_ops - sim_stats_mark.fpga_ops};
+    auto _sleeps{sim_stats.sleeps - sim_stats_mark.sleeps};
+    auto _sleep_us{sim_stats.sleep_us - sim_stats_mark.sleep_us};
+    auto _bus_us{(sim_stats.bus_ns - sim_stats_mark.bus_ns) / 1000};
+
+    LOG_FORMAT(info,
+               "[SIM] %s : reads %lu, writes %lu, bytes %lu, fpga %lu, sleeps %lu (%lu us), bus %lu us",
+               label != nullptr ? label : "",
+               _reads,
+               _writes,
+               _bytes,
+               _fpga,
+               _sleeps,
+               _sleep_us,
+               _bus_us);
+
+    sim_stats_mark = sim_stats;
+}
+
+void SIM_TraceStart() {
+    std::lock_guard<std::mutex> _lock(sim_trace_mutex);
+
+    sim_trace.clear();
+    sim_trace_on = true;
+}
+
+std::vector<std::thread::id> SIM_TraceStop() {
+    std::lock_guard<std::mutex> _lock(sim_trace_mutex);
+
+    sim_trace_on = false;
+    return std::move(sim_trace);
+}
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file      spi_sim.hpp
+/// \version   0.1
+/// \date      October, 2026
+/// \author    Gino Francesco Bogo
+/// \copyright This file is released under the MIT license
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPI_SIM_HPP
+#define SPI_SIM_HPP
+
+#include <cstdint> // uint8_t, uint32_t, uint64_t
+#include <thread>  // thread::id
+#include <vector>  // vector
+
+typedef struct sim_stats {
+    uint64_t reads;       // SPI read transactions
+    uint64_t writes;      // SPI write transactions
+    uint64_t read_bytes;  // register bytes read (command excluded)
+    uint64_t write_bytes; // register bytes written (command excluded)
+    uint64_t fpga_ops;    // FPGA register accesses
+    uint64_t sleeps;      // STIME_uSleep/STIME_mSleep calls
+    uint64_t sleep_us;    // time requested by the sleeps
+    uint64_t bus_ns;      // modelled SPI bus occupation
+} sim_stats_t;
+
+void SIM_Init(uint32_t spi_clock_hz = 10000000);
+
+void SIM_Exit();
+
+bool SIM_IsActive();
+
+void SIM_Reset();
+
+bool SIM_ReadM(uint32_t reg, uint8_t* rx_buf, uint32_t rx_buf_len);
+
+bool SIM_WriteM(uint32_t reg, const uint8_t* tx_buf, uint32_t tx_buf_len);
+
+bool SIM_FpgaWrite(uint32_t reg, uint32_t val);
+
+uint32_t SIM_FpgaRead(uint32_t reg);
+
+void SIM_Sleep(unsigned long delay);
+
+uint8_t SIM_Peek(uint32_t reg);
+
+void SIM_GetStats(sim_stats_t* stats);
+
+void SIM_Report(const char* label);
+
+// NOTE: records the thread of every transaction, to check the bus exclusivity
+void SIM_TraceStart();
+
+std::vector<std::thread::id> SIM_TraceStop();
+
+#endif // SPI_SIM_HPP
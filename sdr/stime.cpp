@@ -9,12 +9,27 @@
 
 #include "stime.hpp"
 
+#include "spi_if.hpp"  // SPI_SDR_RecordWait
+#include "spi_sim.hpp" // SIM_IsActive, SIM_Sleep
+
 #include <unistd.h>
 
 void STIME_uSleep(unsigned long delay) {
+    SPI_SDR_RecordWait(delay);
+
+    if (SIM_IsActive()) {
+        SIM_Sleep(delay);
+        return;
+    }
     usleep(delay);
 }
 
 void STIME_mSleep(unsigned long delay) {
+    SPI_SDR_RecordWait(delay * 1000);
+
+    if (SIM_IsActive()) {
+        SIM_Sleep(delay * 1000);
+        return;
+    }
     usleep(delay * 1000);
 }
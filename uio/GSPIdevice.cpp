@@ -12,16 +12,39 @@
 #include "../lib/GLogger.hpp"
 
 #include <cerrno>      // errno
-#include <cstring>     // memset, strncpy
+#include <cstdio>      // fopen, fscanf
+#include <cstring>     // memcpy, memset, strcmp, strncpy
 #include <fcntl.h>     // open
 #include <sys/ioctl.h> // ioctl
 #include <unistd.h>    // close
 
+// NOTE: spidev rejects messages with more data than its 'bufsiz' parameter
+#define SPIDEV_BUFSIZ_FILE "/sys/module/spidev/parameters/bufsiz"
+#define SPIDEV_BUFSIZ_DEF  4096
+
+// NOTE: the ioctl size field is 14 bits wide (see SPI_MSGSIZE)
+const uint32_t spi_list_max_transfers = ((1 << _IOC_SIZEBITS) - 1) / sizeof(struct spi_ioc_transfer);
+
 auto spi_device_reset = [](spi_device_t* dev, bool clear_all) {
     if (clear_all) {
         memset(dev, 0, sizeof(spi_device_t));
     }
-    dev->fd = -1;
+    dev->fd     = -1;
+    dev->bufsiz = SPIDEV_BUFSIZ_DEF;
+};
+
+auto spidev_bufsiz = []() {
+    uint32_t _bufsiz{SPIDEV_BUFSIZ_DEF};
+
+    auto* _file{fopen(SPIDEV_BUFSIZ_FILE, "r")};
+
+    if (_file != nullptr) {
+        if (fscanf(_file, "%u", &_bufsiz) != 1 || _bufsiz == 0) {
+            _bufsiz = SPIDEV_BUFSIZ_DEF;
+        }
+        fclose(_file);
+    }
+    return _bufsiz;
 };
 
 auto is_mode_legal = [](uint8_t mode) {
@@ -43,6 +66,7 @@ GSPIdevice::GSPIdevice(const char* file,          //
                        uint32_t    max_speed_hz) {
 
     spi_device_reset(&m_dev, true);
+    m_messages = 0;
 
     if (!is_mode_legal(mode)) {
         LOG_FORMAT(warning, "Wrong SPI mode (%d)", mode);
@@ -53,6 +77,7 @@ GSPIdevice::GSPIdevice(const char* file,          //
     m_dev.lsb_first     = lsb_first;
     m_dev.bits_per_word = bits_per_word;
     m_dev.max_speed_hz  = max_speed_hz;
+    m_dev.loopback      = strcmp(file, LOOPBACK) == 0;
 }
 
 GSPIdevice::~GSPIdevice() {
@@ -60,6 +85,10 @@ GSPIdevice::~GSPIdevice() {
 }
 
 bool GSPIdevice::Open() {
+    if (m_dev.loopback) {
+        return true;
+    }
+
     m_dev.fd = open(m_dev.file, O_RDWR);
 
     if (m_dev.fd == -1) {
@@ -87,6 +116,7 @@ bool GSPIdevice::Open() {
         goto fail_ioctl;
     }
 
+    m_dev.bufsiz = spidev_bufsiz();
     return true;
 
 fail_ioctl:
@@ -151,7 +181,7 @@ bool GSPIdevice::Transfer(const void* tx_buf, void* rx_buf, uint32_t buf_len) co
     _msg.len       = (__u32)buf_len;
     _msg.cs_change = 1;
 
-    if (ioctl(m_dev.fd, SPI_IOC_MESSAGE(1), &_msg) == -1) {
+    if (!Message(&_msg, 1)) {
         LOG_FORMAT(error, "SPI MESSAGE(1) transfer failure [E%d]", errno);
         return false;
     }
@@ -166,7 +196,7 @@ bool GSPIdevice::Read(void* rx_buf, uint32_t rx_buf_len) const {
     _msg.rx_buf = (__u64)rx_buf;
     _msg.len    = (__u32)rx_buf_len;
 
-    if (ioctl(m_dev.fd, SPI_IOC_MESSAGE(1), &_msg) == -1) {
+    if (!Message(&_msg, 1)) {
         LOG_FORMAT(error, "SPI MESSAGE(1) reading failure [E%d]", errno);
         return false;
     }
@@ -178,10 +208,10 @@ bool GSPIdevice::Write(void* tx_buf, uint32_t tx_buf_len) const {
     struct spi_ioc_transfer _msg;
     memset(&_msg, 0, sizeof(_msg));
 
-    _msg.rx_buf = (__u64)tx_buf;
+    _msg.tx_buf = (__u64)tx_buf;
     _msg.len    = (__u32)tx_buf_len;
 
-    if (ioctl(m_dev.fd, SPI_IOC_MESSAGE(1), &_msg) == -1) {
+    if (!Message(&_msg, 1)) {
         LOG_FORMAT(error, "SPI MESSAGE(1) writing failure [E%d]", errno);
         return false;
     }
@@ -198,10 +228,106 @@ bool GSPIdevice::WriteThenRead(const void* tx_buf, uint32_t tx_buf_len, void* rx
     _msg[1].rx_buf = (__u64)rx_buf;
     _msg[1].len    = (__u32)rx_buf_len;
 
-    if (ioctl(m_dev.fd, SPI_IOC_MESSAGE(2), _msg) == -1) {
+    if (!Message(_msg, 2)) {
         LOG_FORMAT(error, "SPI MESSAGE(2) transfer failure [E%d]", errno);
         return false;
     }
 
     return true;
 }
+
+void GSPIdevice::ListClear() {
+    m_list.clear();
+}
+
+void GSPIdevice::ListAppend(const void* tx_buf, void* rx_buf, uint32_t buf_len, bool cs_change, uint16_t delay_usecs, uint32_t speed_hz) {
+    struct spi_ioc_transfer _msg;
+    memset(&_msg, 0, sizeof(_msg));
+
+    _msg.tx_buf      = (__u64)tx_buf;
+    _msg.rx_buf      = (__u64)rx_buf;
+    _msg.len         = (__u32)buf_len;
+    _msg.cs_change   = (__u8)cs_change;
+    _msg.delay_usecs = (__u16)delay_usecs;
+    _msg.speed_hz    = (__u32)speed_hz;
+
+    m_list.push_back(_msg);
+}
+
+bool GSPIdevice::ListSubmit() {
+    auto   _ret{true};
+    size_t _head{0};
+
+    while (_ret && _head < m_list.size()) {
+        size_t   _tail{_head};
+        size_t   _safe{_head};
+        uint32_t _bytes{0};
+
+        // fill the chunk up to the driver limits...
+        while (_tail < m_list.size() && _tail - _head < spi_list_max_transfers && _bytes + m_list[_tail].len <= m_dev.bufsiz) {
+            _bytes += m_list[_tail].len;
+            _tail++;
+
+            if (m_list[_tail - 1].cs_change) {
+                _safe = _tail;
+            }
+        }
+
+        if (_tail == _head) {
+            LOG_FORMAT(error, "SPI transfer exceeds the driver buffer [%u > %u]", m_list[_head].len, m_dev.bufsiz);
+            _ret = false;
+            break;
+        }
+
+        // ...but, if possible, split it where the chip select is released
+        if (_tail < m_list.size() && _safe > _head) {
+            _tail = _safe;
+        }
+
+        // NOTE: the message end releases the chip select, a 'cs_change' there would keep it
+        // asserted, also after the last message of the list
+        auto& _last{m_list[_tail - 1]};
+        auto  _cs_change{_last.cs_change};
+
+        _last.cs_change = 0;
+
+        _ret = Message(&m_list[_head], (uint32_t)(_tail - _head));
+
+        if (!_ret) {
+            LOG_FORMAT(error, "SPI MESSAGE(%lu) list failure [E%d]", _tail - _head, errno);
+        }
+
+        _last.cs_change = _cs_change;
+        _head           = _tail;
+    }
+
+    m_list.clear();
+    return _ret;
+}
+
+bool GSPIdevice::Message(struct spi_ioc_transfer* msg, uint32_t msg_num) const {
+    m_messages++;
+
+    if (m_dev.loopback) {
+        // MOSI wired to MISO: rx mirrors tx, a receive-only transfer reads zeros
+        for (decltype(msg_num) i{0}; i < msg_num; ++i) {
+            auto* _rx{(void*)msg[i].rx_buf};
+            auto* _tx{(const void*)msg[i].tx_buf};
+
+            if (_rx == nullptr) {
+                continue;
+            }
+
+            if (_tx != nullptr) {
+                memcpy(_rx, _tx, msg[i].len);
+            }
+            else {
+                memset(_rx, 0, msg[i].len);
+            }
+        }
+        return true;
+    }
+
+    // NOTE: same request code as SPI_IOC_MESSAGE(msg_num), which needs a constant
+    return ioctl(m_dev.fd, _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, SPI_MSGSIZE(msg_num)), msg) != -1;
+}
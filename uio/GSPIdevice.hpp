@@ -11,7 +11,8 @@
 #define GSPIDEVICE_HPP
 
 #include <cstdint>            // uint8_t, uint32_t
-#include <linux/spi/spidev.h> // SPI_MODE_*
+#include <linux/spi/spidev.h> // SPI_MODE_*, spi_ioc_transfer
+#include <vector>             // vector
 
 const auto spi_device_t_file_maxlen = 64;
 
@@ -24,6 +25,9 @@ struct spi_device_t {
     uint8_t  lsb_first;
     uint8_t  bits_per_word;
     uint32_t max_speed_hz;
+    // SECTION: driver limits
+    uint32_t bufsiz;
+    bool     loopback;
 };
 
 class GSPIdevice {
@@ -45,8 +49,30 @@ class GSPIdevice {
     bool Write(void* tx_buf, uint32_t tx_buf_len) const;
     bool WriteThenRead(const void* tx_buf, uint32_t tx_buf_len, void* rx_buf, uint32_t rx_buf_len) const;
 
+    // SECTION: transaction list
+
+    void ListClear();
+    // NOTE: 'cs_change' releases the chip select after the transfer (one frame per append),
+    // it is dropped on the last transfer of every message, so the bus is always left idle
+    void ListAppend(const void* tx_buf, void* rx_buf, uint32_t buf_len, bool cs_change = true, uint16_t delay_usecs = 0, uint32_t speed_hz = 0);
+    bool ListSubmit();
+
+    [[nodiscard]] auto ListSize() const {
+        return m_list.size();
+    }
+
+    [[nodiscard]] auto GetMessages() const {
+        return m_messages;
+    }
+
+    static constexpr const char* LOOPBACK{"loopback"};
+
   private:
-    spi_device_t m_dev;
+    bool Message(struct spi_ioc_transfer* msg, uint32_t msg_num) const;
+
+    spi_device_t                         m_dev;
+    std::vector<struct spi_ioc_transfer> m_list;
+    mutable uint64_t                     m_messages;
 };
 
 #endif // GSPIDEVICE_HPP